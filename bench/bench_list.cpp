@@ -0,0 +1,670 @@
+extern "C"
+{
+        #include "list.h"
+}
+#include "list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#if defined(__GLIBC__)
+    #include <malloc.h>
+#endif
+
+//setup stuff
+void bench_free_fnc(void* a)
+{
+    (void)a;
+    return;
+}
+//List_Reduce_Fnc that only counts, so timings measure the walk and not the payload
+void* count_reducer(const void* a, void* acc)
+{
+    (void)a;
+    (*(size_t*)acc)++;
+    return acc;
+}
+
+//time a callable, returning the best of a few runs in nanoseconds
+template <typename Fnc>
+double best_ns(int runs, Fnc fnc)
+{
+    double best = 0;
+    for (int r = 0; r < runs; r++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fnc();
+        auto end = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        if (0 == r || ns < best) best = ns;
+    }
+    return best;
+}
+
+//Build a list whose nodes are scattered across the heap relative to traversal order.
+//Nodes are allocated round-robin across many lists, then drained into one list in random order.
+List_t* scattered_list(size_t count, int* vals)
+{
+    const size_t stream_count = 1024;
+    std::vector<List_t*> streams(stream_count);
+    for (size_t s = 0; s < stream_count; s++)
+    {
+        streams[s] = List_Create(0, NULL, bench_free_fnc);
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        vals[i] = (int)i;
+        List_Push(&vals[i], streams[i % stream_count]);
+    }
+
+    List_t* list_p = List_Create(0, NULL, bench_free_fnc);
+    srand(1);
+    size_t left = count;
+    while (left)
+    {
+        List_t* stream_p = streams[(size_t)rand() % stream_count];
+        if (0 != List_Length(stream_p))
+        {
+            List_Transfer(stream_p, 0, list_p, List_Length(list_p));
+            left--;
+        }
+    }
+    for (size_t s = 0; s < stream_count; s++)
+    {
+        List_Destroy(streams[s]);
+    }
+    return list_p;
+}
+
+//bytes currently held by the allocator, or 0 where that cant be asked
+size_t heap_bytes()
+{
+#if defined(__GLIBC__) && defined(__GLIBC_PREREQ)
+    #if __GLIBC_PREREQ(2, 33)
+        struct mallinfo2 info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+    #endif
+#endif
+    return 0;
+}
+
+//List_Create_Compact
+//{
+    //push count ints into a freshly made list, reporting the heap it took per element and the time to walk it
+    void bench_memory_one(const char* name, List_t* list_p, size_t count, int* vals, size_t base)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            vals[i] = (int)i;
+            List_Push(&vals[i], list_p);
+        }
+        size_t used = heap_bytes() - base;
+        size_t seen = 0;
+        double scan = best_ns(5, [&]{ seen = 0; List_Reduce(list_p, count_reducer, &seen); });
+
+        if (0 != base)
+        {
+            printf("    %-22s %6.1f bytes/element, scan %6.2f ns/element\n", name, (double)used / count, scan / count);
+        }
+        else
+        {
+            printf("    %-22s    n/a bytes/element, scan %6.2f ns/element\n", name, scan / count);
+        }
+        List_Destroy(list_p);
+    }
+
+    void bench_memory(size_t count)
+    {
+        std::vector<int> vals(count);
+        printf("List_Create_Compact (%zu ints, list overhead only)\n", count);
+
+        size_t base = heap_bytes();
+        bench_memory_one("nodes, pointers", List_Create(0, NULL, bench_free_fnc), count, vals.data(), base);
+        base = heap_bytes();
+        bench_memory_one("nodes, inline ints", List_Create_Sized(sizeof(int), 0, NULL), count, vals.data(), base);
+        base = heap_bytes();
+        bench_memory_one("compact, pointers", List_Create_Compact(0, NULL, bench_free_fnc), count, vals.data(), base);
+        base = heap_bytes();
+        bench_memory_one("compact, inline ints", List_Create_Compact_Sized(sizeof(int), 0, NULL), count, vals.data(), base);
+    }
+//}
+
+//List_Compact
+//{
+    void bench_compact(size_t count)
+    {
+        std::vector<int> vals(count);
+        List_t* list_p = scattered_list(count, vals.data());
+        size_t seen = 0;
+
+        double before = best_ns(5, [&]{ seen = 0; List_Reduce(list_p, count_reducer, &seen); });
+        double compact = best_ns(1, [&]{ List_Compact(list_p); });
+        double after = best_ns(5, [&]{ seen = 0; List_Reduce(list_p, count_reducer, &seen); });
+
+        printf("List_Compact (%zu nodes)\n", count);
+        printf("    scan scattered:  %8.2f ns/node\n", before / count);
+        printf("    compaction:      %8.2f ns/node\n", compact / count);
+        printf("    scan compacted:  %8.2f ns/node (%.1fx)\n", after / count, before / after);
+
+        List_Destroy(list_p);
+    }
+//}
+
+//List_Create_Deque
+//{
+    //run the usual queue and stack operations over a list, printing ns per operation for each
+    void bench_deque_one(const char* name, List_t* list_p, size_t count, int* vals)
+    {
+        double push = best_ns(1, [&]{ for (size_t i = 0; i < count; i++) List_Push(&vals[i], list_p); });
+        volatile size_t sink = 0;
+        //stride through the list so node lists cant just follow their links, few samples since those walk half the list
+        const size_t samples = 256;
+        double at = best_ns(1, [&]{
+            for (size_t i = 0, j = 0; i < samples; i++, j = (j + 7919) % count) sink = sink + *(int*)List_At(j, list_p);
+        });
+        double shift = best_ns(1, [&]{ for (size_t i = 0; i < count; i++) List_Shift(list_p); });
+        double unshift = best_ns(1, [&]{ for (size_t i = 0; i < count; i++) List_Unshift(&vals[i], list_p); });
+        double pop = best_ns(1, [&]{ for (size_t i = 0; i < count; i++) List_Pop(list_p); });
+        //a queue that never holds more than a few elements, the common case for work queues
+        double churn = best_ns(1, [&]{
+            for (size_t i = 0; i < count; i++)
+            {
+                List_Push(&vals[i], list_p);
+                if (4 < List_Length(list_p)) List_Shift(list_p);
+            }
+        });
+
+        printf("    %-10s push %6.2f  List_At %9.2f  shift %6.2f  unshift %6.2f  pop %6.2f  queue %6.2f ns/op\n",
+            name, push / count, at / samples, shift / count, unshift / count, pop / count, churn / count);
+        List_Destroy(list_p);
+    }
+
+    void bench_deque(size_t count)
+    {
+        std::vector<int> vals(count);
+        for (size_t i = 0; i < count; i++) vals[i] = (int)i;
+        printf("List_Create_Deque (%zu elements)\n", count);
+
+        bench_deque_one("nodes", List_Create(0, NULL, bench_free_fnc), count, vals.data());
+        bench_deque_one("deque", List_Create_Deque(0, NULL, bench_free_fnc), count, vals.data());
+    }
+//}
+
+//List_Sort_By_Key
+//{
+    int bench_cmp_fnc(const void* a, const void* b)
+    {
+        return (*(int*)a > *(int*)b) - (*(int*)a < *(int*)b);
+    }
+    uint64_t bench_key_fnc(const void* a)
+    {
+        return (uint64_t)(uint32_t)*(int*)a;
+    }
+
+    //sort the same shuffled list by comparison and by key, printing ns per element for each
+    void bench_sort(size_t count)
+    {
+        std::vector<int> vals(count);
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < count; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            vals[i] = (int)(seed >> 1);
+        }
+        printf("List_Sort_By_Key (%zu elements)\n", count);
+
+        List_t* list_p = List_Create(0, bench_cmp_fnc, bench_free_fnc);
+        for (size_t i = 0; i < count; i++) List_Push(&vals[i], list_p);
+        double cmp = best_ns(1, [&]{ List_Sort(list_p, NULL); });
+        List_Destroy(list_p);
+
+        list_p = List_Create(0, bench_cmp_fnc, bench_free_fnc);
+        for (size_t i = 0; i < count; i++) List_Push(&vals[i], list_p);
+        double key = best_ns(1, [&]{ List_Sort_By_Key(list_p, bench_key_fnc, 4); });
+        List_Destroy(list_p);
+
+        printf("    List_Sort %6.2f  List_Sort_By_Key %6.2f ns/element\n", cmp / count, key / count);
+    }
+//}
+
+//LIST_FOREACH
+//{
+    void bench_sum_chunk(void** items, size_t count, void* ctx)
+    {
+        long long sum = 0;
+        for (size_t i = 0; i < count; i++) sum += *(int*)items[i];
+        *(long long*)ctx += sum;
+    }
+    //sum a short list many times over with each way of walking it, printing ns per element for each
+    void bench_foreach(size_t count)
+    {
+        const size_t length = 64;
+        const size_t rounds = (count + length - 1) / length;
+        std::vector<int> vals(length);
+        List_t* list_p = List_Create(0, NULL, bench_free_fnc);
+        for (size_t i = 0; i < length; i++)
+        {
+            vals[i] = (int)i;
+            List_Push(&vals[i], list_p);
+        }
+        printf("LIST_FOREACH (%zu walks of %zu elements)\n", rounds, length);
+        volatile long long sink = 0;
+        double elements = (double)(rounds * length);
+
+        double created = best_ns(3, [&]{
+            long long sum = 0;
+            for (size_t r = 0; r < rounds; r++)
+            {
+                List_Iterator_p iter_p = List_Iterator_Create(list_p);
+                for (void* data_p = List_Iterator_Next(iter_p); NULL != data_p; data_p = List_Iterator_Next(iter_p)) sum += *(int*)data_p;
+                List_Iterator_Destroy(iter_p);
+            }
+            sink = sink + sum;
+        });
+        double init = best_ns(3, [&]{
+            long long sum = 0;
+            for (size_t r = 0; r < rounds; r++)
+            {
+                List_Iterator_Storage storage;
+                List_Iterator_p iter_p = List_Iterator_Init(&storage, list_p, false);
+                for (void* data_p = List_Iterator_Next(iter_p); NULL != data_p; data_p = List_Iterator_Next(iter_p)) sum += *(int*)data_p;
+            }
+            sink = sink + sum;
+        });
+        double foreach = best_ns(3, [&]{
+            long long sum = 0;
+            for (size_t r = 0; r < rounds; r++)
+            {
+                LIST_FOREACH(list_p, data_p) sum += *(int*)data_p;
+            }
+            sink = sink + sum;
+        });
+        double chunk = best_ns(3, [&]{
+            long long sum = 0;
+            for (size_t r = 0; r < rounds; r++)
+            {
+                List_For_Each_Chunk(list_p, bench_sum_chunk, 0, &sum);
+            }
+            sink = sink + sum;
+        });
+
+        printf("    List_Iterator_Create %6.2f  List_Iterator_Init %6.2f  LIST_FOREACH %6.2f  List_For_Each_Chunk %6.2f ns/element\n",
+            created / elements, init / elements, foreach / elements, chunk / elements);
+        List_Destroy(list_p);
+    }
+//}
+
+//List_Pipeline
+//{
+    void* bench_double_copy(const void* a)
+    {
+        int* copy_p = (int*)malloc(sizeof(int));
+        if (NULL != copy_p) *copy_p = *(const int*)a * 2;
+        return copy_p;
+    }
+    bool bench_is_mult_4(const void* a)
+    {
+        return 0 == *(const int*)a % 4;
+    }
+    void* bench_sum_reducer(const void* a, void* acc)
+    {
+        *(long long*)acc += *(const int*)a;
+        return acc;
+    }
+    //double, filter and sum a list by chaining copy, filter and reduce, then with one fused pipeline, printing ns per element
+    void bench_pipeline(size_t count)
+    {
+        //copies share the free function of their source, so the source owns its values too
+        List_t* list_p = List_Create(0, NULL, free);
+        for (size_t i = 0; i < count; i++)
+        {
+            int val = (int)i;
+            List_Push(bench_double_copy(&val), list_p);
+        }
+        printf("List_Pipeline (%zu elements)\n", count);
+        volatile long long sink = 0;
+
+        double chained = best_ns(3, [&]{
+            long long sum = 0;
+            List_t* copy_p = List_Copy(list_p, bench_double_copy);
+            List_Filter(copy_p, bench_is_mult_4);
+            List_Reduce(copy_p, bench_sum_reducer, &sum);
+            List_Destroy(copy_p);
+            sink = sink + sum;
+        });
+        List_Pipeline_p pipeline_p = List_Pipeline_Create(list_p);
+        List_Pipeline_Map(pipeline_p, bench_double_copy, free);
+        List_Pipeline_Filter(pipeline_p, bench_is_mult_4);
+        double fused = best_ns(3, [&]{
+            long long sum = 0;
+            List_Pipeline_Reduce(pipeline_p, bench_sum_reducer, &sum);
+            sink = sink + sum;
+        });
+
+        printf("    copy+filter+reduce %6.2f  pipeline %6.2f ns/element\n", chained / count, fused / count);
+        List_Pipeline_Destroy(pipeline_p);
+        List_Destroy(list_p);
+    }
+//}
+
+//List_Map
+//{
+    //the mapped values live in a preallocated array, so timings measure the list and not malloc
+    static std::vector<int> bench_mapped;
+    void* bench_map_fnc(const void* a)
+    {
+        int at = *(const int*)a;
+        bench_mapped[at] = at * 2;
+        return &bench_mapped[at];
+    }
+    //map a list into a new one by pushing each mapped value, then with List_Map, printing ns per element
+    void bench_map(size_t count)
+    {
+        List_t* list_p = List_Create_Sized(sizeof(int), 0, NULL);
+        for (size_t i = 0; i < count; i++)
+        {
+            int val = (int)i;
+            List_Push(&val, list_p);
+        }
+        bench_mapped.assign(count, 0);
+        printf("List_Map (%zu elements)\n", count);
+        volatile size_t sink = 0;
+
+        double pushed = best_ns(3, [&]{
+            List_t* map_p = List_Create(0, NULL, bench_free_fnc);
+            LIST_FOREACH(list_p, val_p)
+            {
+                List_Push(bench_map_fnc(val_p), map_p);
+            }
+            sink = sink + List_Length(map_p);
+            List_Destroy(map_p);
+        });
+        double mapped = best_ns(3, [&]{
+            List_t* map_p = List_Map(list_p, bench_map_fnc, bench_free_fnc);
+            sink = sink + List_Length(map_p);
+            List_Destroy(map_p);
+        });
+
+        printf("    push each %6.2f  List_Map %6.2f ns/element\n", pushed / count, mapped / count);
+        List_Destroy(list_p);
+    }
+//}
+
+//List_Clone_COW
+//{
+    //snapshot a list for a reader that only sums it, with List_Copy and then List_Clone_COW, printing ms per snapshot
+    void bench_clone(size_t count)
+    {
+        List_t* list_p = List_Create_Sized(sizeof(int), 0, NULL);
+        for (size_t i = 0; i < count; i++)
+        {
+            int val = (int)i;
+            List_Push(&val, list_p);
+        }
+        printf("List_Clone_COW (%zu elements)\n", count);
+        volatile int64_t sink = 0;
+
+        double copied = best_ns(3, [&]{
+            List_t* copy_p = List_Copy(list_p, NULL);
+            int64_t sum = 0;
+            List_Sum(copy_p, LIST_NUM_INT32, &sum);
+            sink = sink + sum;
+            List_Destroy(copy_p);
+        });
+        double cloned = best_ns(3, [&]{
+            List_t* clone_p = List_Clone_COW(list_p);
+            int64_t sum = 0;
+            List_Sum(clone_p, LIST_NUM_INT32, &sum);
+            sink = sink + sum;
+            List_Destroy(clone_p);
+        });
+        double summed = best_ns(3, [&]{
+            int64_t sum = 0;
+            List_Sum(list_p, LIST_NUM_INT32, &sum);
+            sink = sink + sum;
+        });
+
+        printf("    copy+sum %8.2f  clone+sum %8.2f  sum alone %8.2f ms\n", copied / 1e6, cloned / 1e6, summed / 1e6);
+        List_Destroy(list_p);
+    }
+//}
+
+//List_Sort_Concurrent
+//{
+    //longest a thread calling List_At waits while a shuffled list is sorted, in ms
+    double sort_stall_ms(size_t count, List_Error_t (*sort_fnc)(List_t*, List_Cmp_Fnc))
+    {
+        List_t* list_p = List_Create_Sized(sizeof(int), 0, bench_cmp_fnc);
+        uint32_t seed = 12345;
+        for (size_t i = 0; i < count; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            int val = (int)(seed >> 1);
+            List_Push(&val, list_p);
+        }
+        std::atomic<bool> sorting(true);
+        double worst = 0;
+        std::thread reader([&]{
+            while (sorting)
+            {
+                auto start = std::chrono::steady_clock::now();
+                List_At(0, list_p);
+                worst = std::max(worst, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            }
+        });
+        sort_fnc(list_p, NULL);
+        sorting = false;
+        reader.join();
+        List_Destroy(list_p);
+        return worst;
+    }
+
+    //sort while another thread reads the list, printing the longest the reader was held up by each sort
+    void bench_sort_concurrent(size_t count)
+    {
+        printf("List_Sort_Concurrent (%zu elements)\n", count);
+        double locked = sort_stall_ms(count, List_Sort);
+        double concurrent = sort_stall_ms(count, List_Sort_Concurrent);
+        printf("    longest reader wait: List_Sort %8.2f  List_Sort_Concurrent %8.2f ms\n", locked, concurrent);
+    }
+//}
+
+//List_Set_Prefetch_Distance
+//{
+    void* payload_reducer(const void* a, void* acc)
+    {
+        *(long long*)acc += *(const int*)a;
+        return acc;
+    }
+    //a reducer doing some work per element, the case a walk running ahead of itself is meant for
+    void* working_reducer(const void* a, void* acc)
+    {
+        unsigned long long x = (unsigned long long)*(const int*)a;
+        for (int i = 0; i < 50; i++) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        *(long long*)acc += (long long)(x >> 33);
+        return acc;
+    }
+    //reduce a scattered list twice the size of the last level cache at a few prefetch distances, printing ns per element
+    void bench_prefetch(size_t count)
+    {
+        long llc = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+        llc = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+        if (0 >= llc)
+        {
+            llc = 32L << 20;
+        }
+        //each element is a 32 byte node and a 4 byte int it points at
+        size_t length = std::max(count, (size_t)2 * (size_t)llc / 36);
+        std::vector<int> vals(length);
+        List_t* list_p = scattered_list(length, vals.data());
+        printf("List_Set_Prefetch_Distance (%zu scattered elements, %ld KiB last level cache)\n", length, llc >> 10);
+        volatile long long sink = 0;
+        List_Reduce_Fnc reducers[] = {payload_reducer, working_reducer};
+        const char* names[] = {"sum only", "50 multiplies"};
+        for (size_t r = 0; r < 2; r++)
+        {
+            printf("    %-14s", names[r]);
+            for (size_t distance : {0, 2, 4, 8, 16, 32})
+            {
+                List_Set_Prefetch_Distance(list_p, distance);
+                double ns = best_ns(2, [&]{
+                    long long sum = 0;
+                    List_Reduce(list_p, reducers[r], &sum);
+                    sink = sink + sum;
+                });
+                printf(" %2zu: %6.2f", distance, ns / length);
+            }
+            printf(" ns/element\n");
+        }
+        List_Destroy(list_p);
+    }
+//}
+
+//List_Reverse
+//{
+    //reverse a scattered list lazily and in place, then walk it, printing ms per reverse and per walk
+    void bench_reverse(size_t count)
+    {
+        std::vector<int> vals(count);
+        List_t* list_p = scattered_list(count, vals.data());
+        printf("List_Reverse (%zu elements)\n", count);
+        long long sum = 0;
+
+        double lazy = best_ns(5, [&]{ List_Reverse(list_p); });
+        double in_place = best_ns(5, [&]{ List_Reverse_In_Place(list_p); });
+        //an odd number of lazy reverses above leaves the list reading back to front
+        double walk_reversed = best_ns(3, [&]{ List_Reduce(list_p, payload_reducer, &sum); });
+        List_Reverse(list_p);
+        double walk_forward = best_ns(3, [&]{ List_Reduce(list_p, payload_reducer, &sum); });
+
+        printf("    List_Reverse %8.4f  List_Reverse_In_Place %8.2f ms\n", lazy / 1e6, in_place / 1e6);
+        printf("    walk reversed %8.2f  walk forward %8.2f ms\n", walk_reversed / 1e6, walk_forward / 1e6);
+        List_Destroy(list_p);
+    }
+//}
+
+//List_Sum
+//{
+    void* int32_sum_reducer(const void* a, void* acc)
+    {
+        *(int64_t*)acc += *(const int32_t*)a;
+        return acc;
+    }
+    //sum sized int lists in node and ring storage with a List_Reduce callback and with List_Sum, printing ns per element
+    void bench_sum(size_t count)
+    {
+        printf("List_Sum (%zu elements)\n", count);
+        List_t* lists[] = {List_Create_Sized(sizeof(int32_t), 0, NULL), List_Create_Deque_Sized(sizeof(int32_t), 0, NULL)};
+        const char* names[] = {"nodes", "deque"};
+        for (size_t l = 0; l < 2; l++)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                int32_t val = (int32_t)i;
+                List_Push(&val, lists[l]);
+            }
+            volatile int64_t sink = 0;
+            double reduce = best_ns(3, [&]{
+                int64_t sum = 0;
+                List_Reduce(lists[l], int32_sum_reducer, &sum);
+                sink = sink + sum;
+            });
+            double simd = best_ns(3, [&]{
+                int64_t sum = 0;
+                List_Sum(lists[l], LIST_NUM_INT32, &sum);
+                sink = sink + sum;
+            });
+            printf("    %s: List_Reduce %6.2f  List_Sum %6.2f ns/element\n", names[l], reduce / count, simd / count);
+            List_Destroy(lists[l]);
+        }
+    }
+//}
+
+//clist::list
+//{
+    int bench_raw_cmp_fnc(const void* a, const void* b)
+    {
+        return (*(const int*)a > *(const int*)b) - (*(const int*)a < *(const int*)b);
+    }
+    void* sum_reducer(const void* a, void* acc)
+    {
+        *(long long*)acc += *(const int*)a;
+        return acc;
+    }
+
+    //the same work through std::list, clist::list and the C functions directly, printing ns per element for each
+    void bench_cpp(size_t count)
+    {
+        std::vector<int> vals(count);
+        uint32_t seed = 54321;
+        for (size_t i = 0; i < count; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            vals[i] = (int)(seed >> 1);
+        }
+        const int missing = -1;
+        printf("clist::list (%zu elements)\n", count);
+        volatile long long sink = 0;
+
+        {
+            std::list<int> list;
+            double push = best_ns(1, [&]{ for (size_t i = 0; i < count; i++) list.push_back(vals[i]); });
+            double sort = best_ns(1, [&]{ list.sort(std::greater<int>()); });
+            double walk = best_ns(1, [&]{ long long sum = 0; for (int v : list) sum += v; sink = sink + sum; });
+            double find = best_ns(1, [&]{ sink = sink + (std::find(list.begin(), list.end(), missing) == list.end()); });
+            printf("    %-12s push %6.2f  sort %7.2f  walk %6.2f  find %6.2f ns/element\n", "std::list",
+                push / count, sort / count, walk / count, find / count);
+        }
+        {
+            clist::list<int> list;
+            double push = best_ns(1, [&]{ for (size_t i = 0; i < count; i++) list.push_back(vals[i]); });
+            double sort = best_ns(1, [&]{ list.sort(); });
+            double walk = best_ns(1, [&]{ long long sum = 0; for (int v : list) sum += v; sink = sink + sum; });
+            double find = best_ns(1, [&]{ sink = sink + (list.find(missing) == list.end()); });
+            printf("    %-12s push %6.2f  sort %7.2f  walk %6.2f  find %6.2f ns/element\n", "clist::list",
+                push / count, sort / count, walk / count, find / count);
+        }
+        {
+            List_t* list_p = List_Create_Sized(sizeof(int), 0, bench_raw_cmp_fnc);
+            double push = best_ns(1, [&]{ for (size_t i = 0; i < count; i++) List_Push(&vals[i], list_p); });
+            double sort = best_ns(1, [&]{ List_Sort(list_p, NULL); });
+            double walk = best_ns(1, [&]{ long long sum = 0; List_Reduce(list_p, sum_reducer, &sum); sink = sink + sum; });
+            int search = missing;
+            size_t at = 0;
+            double find = best_ns(1, [&]{ sink = sink + (LIST_ERROR_SUCCESS == List_Find(&search, list_p, &at)); });
+            printf("    %-12s push %6.2f  sort %7.2f  walk %6.2f  find %6.2f ns/element\n", "C",
+                push / count, sort / count, walk / count, find / count);
+            List_Destroy(list_p);
+        }
+    }
+//}
+
+int main(int argc, char** argv)
+{
+    //optionally scale the element counts from the command line
+    size_t count = (1 < argc) ? strtoull(argv[1], NULL, 10) : (size_t)1 << 21;
+
+    bench_compact(count);
+    bench_memory(count);
+    bench_deque(count);
+    bench_sort(count);
+    bench_foreach(count);
+    bench_sum(count);
+    bench_pipeline(count);
+    bench_map(count);
+    bench_clone(count);
+    bench_sort_concurrent(count);
+    bench_prefetch(count);
+    bench_reverse(count);
+    bench_cpp(count);
+
+    return 0;
+}
@@ -3,6 +3,11 @@
  */
  
 #include "list.h"
+#include <stddef.h> //max_align_t
+#include <stdatomic.h>
+#include <unistd.h> //sysconf
+
+typedef struct List_Node_Block List_Node_Block;
 
 /*
  *  @brief The stucture of a node in the list.
@@ -13,8 +18,56 @@ struct List_Node
 	void* data_p; //data pointer held in node
 	List_Node* next_p; //next node
 	List_Node* previous_p; //previous node
+	List_Node_Block* block_p; //block the node was carved from or NULL if allocated on its own
+	//inline element bytes follow at LIST_NODE_HEADER_SIZE for sized lists
+};
+
+//round a size up to the strictest alignment malloc guarantees
+#define LIST_ALIGN_UP(size) (((size) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+//offset of the inline element bytes within a node
+#define LIST_NODE_HEADER_SIZE LIST_ALIGN_UP(sizeof(List_Node))
+//pointer to the inline element bytes of a node
+#define LIST_NODE_INLINE(node_p) ((void*)((unsigned char*)(node_p) + LIST_NODE_HEADER_SIZE))
+
+/*
+ *  @brief A run of nodes allocated with a single malloc.
+ *	   Nodes carved from a block may end up in any list, so the block is freed by whoever destroys its last node.
+ */
+struct List_Node_Block
+{
+	atomic_size_t refs; //nodes carved from this block that are still alive
+	_Alignas(max_align_t) unsigned char nodes[]; //the nodes themselves, each the owning list's node size
 };
 
+/*
+ *  @brief How the elements of a list are kept in memory.
+ */
+typedef enum List_Storage
+{
+	LIST_STORAGE_NODES, //separately allocated nodes linked by pointers
+	LIST_STORAGE_INDEX, //slots of a single growable array linked by 32 bit indices
+	LIST_STORAGE_RING, //a single growable array used as a circular buffer, elements kept in list order
+}
+List_Storage;
+
+/*
+ *  @brief The links of a slot in an index storage list, kept right after the slot's element.
+ */
+typedef struct List_Index_Links
+{
+	uint32_t next; //slot of the next element or LIST_INDEX_NONE
+	uint32_t previous; //slot of the previous element or LIST_INDEX_NONE
+}
+List_Index_Links;
+
+//bytes set aside after every node storage list for its first few nodes, enough for 8 nodes holding caller pointers
+#define LIST_POOL_BYTES (8 * LIST_NODE_HEADER_SIZE)
+
+//marks the end of a chain of slots
+#define LIST_INDEX_NONE UINT32_MAX
+//every other 32 bit value names a slot
+#define LIST_INDEX_MAX_SLOTS ((size_t)LIST_INDEX_NONE)
+
 /*
  *  @brief The list itself.
  */
@@ -24,49 +77,236 @@ typedef struct List_t
 	size_t max_length; //max allowed length
 
 	List_Node* head_p;
+	List_Node* tail_p; //last node, kept so appends and concatenation are O(1)
+	bool reversed; //the list reads from its last element to its first, which is all List_Reverse changes
+	size_t writes; //bumped by everything that writes the elements or moves them, so a snapshot can tell it is stale
 
 	List_Cmp_Fnc cmp;
 	List_Free_Fnc free;
 
+	size_t elem_size; //bytes of each element stored inline in its node, 0 when nodes hold caller pointers
+	size_t node_size; //bytes allocated per node, or per slot for index and ring storage
+
+	size_t churn; //nodes linked or unlinked since the last compaction
+	size_t compact_threshold; //churn, as a percentage of length, that triggers a compaction. 0 disables it
+	size_t prefetch_distance; //elements a walk fetches ahead of itself, 0 disables it
+
+	List_Storage storage;
+	//index storage only, head_p and tail_p are unused
+	unsigned char* slots_p; //every slot, the element first and its List_Index_Links at links_offset
+	size_t links_offset;
+	size_t slot_capacity; //slots allocated
+	size_t slot_count; //slots handed out at least once, everything past this has never been used
+	uint32_t head_slot;
+	uint32_t tail_slot;
+	uint32_t free_slot; //first unused slot below slot_count, the rest are chained through their next link
+	//ring storage only, shares slots_p and slot_capacity with index storage
+	size_t ring_head; //slot of the first element, the rest follow it and wrap around
+	bool heap; //elements are kept as a binary heap by cmp instead of in the order they were put in
+
+	//node storage only, nodes come from the pool while it lasts so small lists never allocate
+	unsigned char* pool_p; //the nodes following the list, in its own allocation or in a caller buffer
+	List_Node* pool_free_p; //unused pool nodes chained through next_p, their data_p is always NULL
+	size_t pool_count; //nodes the pool holds at this list's node size
+	size_t pool_used; //pool nodes currently handed out
+	bool in_buffer; //the list and every node live in caller storage, so nothing is ever allocated or freed
+
+	//copy on write clones only, the fields above mirror the shared storage until the list writes to it
+	List_t* share_p; //hidden list owning storage shared with other lists, NULL when the storage is this list's own
+	atomic_size_t shares; //for a hidden list, how many lists share its storage
+
 	pthread_mutex_t lock; // mutex for list access
 }
 List_t;
 
+//address of a slot and of its links
+#define LIST_SLOT(list_p, slot) ((list_p)->slots_p + (size_t)(slot) * (list_p)->node_size)
+#define LIST_SLOT_LINKS(list_p, slot) ((List_Index_Links*)(LIST_SLOT(list_p, slot) + (list_p)->links_offset))
+
+/*
+ *  @brief The position of an element, whatever storage its list uses.
+ *	   This is the node pointer for node storage, the slot plus one for index storage
+ *	   and the element's index plus one for ring storage, so 0 is never a valid position.
+ */
+typedef uintptr_t List_Pos;
+#define LIST_POS_NONE ((List_Pos)0)
+#define LIST_POS_OF_SLOT(slot) ((LIST_INDEX_NONE == (slot)) ? LIST_POS_NONE : (List_Pos)(slot) + 1)
+#define LIST_SLOT_OF_POS(pos) ((uint32_t)((pos) - 1))
+#define LIST_POS_OF_RING(at) ((List_Pos)(at) + 1)
+#define LIST_RING_OF_POS(pos) ((size_t)((pos) - 1))
+
+
+//lists shorter than this are never compacted automatically
+#define LIST_COMPACT_MIN_LENGTH 64
+//slots an index or ring storage list starts out with once it first needs some
+#define LIST_INDEX_MIN_SLOTS 8
+//lists up to this long are sorted without allocating
+#define LIST_SORT_STACK_ENTRIES 16
+//times List_Sort_Concurrent sorts a snapshot the list is written under before it sorts under the lock instead
+#define LIST_SORT_RETRIES 3
+//elements a walk fetches ahead of itself unless the list is told otherwise, and the most it can be told
+#define LIST_PREFETCH_DEFAULT 8
+#define LIST_PREFETCH_MAX 256
+//ask for memory to be brought into cache without waiting for it, does nothing where the compiler cant
+#if defined(__GNUC__)
+#define LIST_PREFETCH(addr_p) __builtin_prefetch(addr_p)
+#else
+#define LIST_PREFETCH(addr_p) ((void)(addr_p))
+#endif
+//chunk size used when none is given, chunks up to this size are gathered on the stack
+#define LIST_CHUNK_STACK_ITEMS 64
 
 #define LIST_ITER_FLAG_REVERSE 0x01
 #define LIST_ITER_FLAG_FINISHED 0x02
+#define LIST_ITER_FLAG_EMBEDDED 0x04 //lives in caller storage rather than being allocated
 /*
  *  @brief An iterator and its metadata.
  */
 typedef struct List_Iterator_t
 {
 	List_p list_p;
-	List_Node* curr_p;
+	List_Pos curr_pos;
 	uint8_t flags;
 }
 List_Iterator_t;
 
+_Static_assert(sizeof(List_Iterator_t) <= sizeof(List_Iterator_Storage), "List_Iterator_Storage is too small");
+//LIST_FOREACH walks nodes through List_Node_Head, so the two have to agree
+_Static_assert(offsetof(List_Node, data_p) == offsetof(List_Node_Head, data_p), "List_Node_Head does not match List_Node");
+_Static_assert(offsetof(List_Node, next_p) == offsetof(List_Node_Head, next_p), "List_Node_Head does not match List_Node");
+
 /*
  *  @brief Create a list node structure.
- *  @param void* The data to hold within the node.
+ *  @param void* The data to hold within the node. For sized lists the element is copied in from here.
+ *  @param List_t* The list the node is meant for.
  *  @return List_Node* A pointer to the allocated node or NULL on error.
  */
-static List_Node* List_Node_Create(void* data_p) //N/A
+static List_Node* List_Node_Create(void* data_p, List_t* list_p) //N/A
 {
 	if (NULL == data_p)
 	{
 		return NULL;
 	}
-	List_Node* new_node_p = malloc(sizeof(List_Node));
+	List_Node* new_node_p = malloc(list_p->node_size);
 	if (NULL != new_node_p)
 	{
 		new_node_p->data_p = data_p;
 		new_node_p->next_p = NULL;
 		new_node_p->previous_p = NULL;
+		new_node_p->block_p = NULL;
+		if (0 != list_p->elem_size)
+		{
+			new_node_p->data_p = LIST_NODE_INLINE(new_node_p);
+			memcpy(new_node_p->data_p, data_p, list_p->elem_size);
+		}
 	}
 	return new_node_p;
 }
 
+/*
+ *  @brief Allocate a number of nodes with a single allocation, already linked to each other in order.
+ *	   The data of every node is left NULL for the caller to fill in, or pointing at its inline bytes for sized lists.
+ *  @param size_t The number of nodes to allocate, must be at least 1.
+ *  @param List_t* The list the nodes are meant for.
+ *  @return List_Node* A pointer to the first node of the chain or NULL on error.
+ */
+static List_Node* List_Node_Block_Create(size_t count, List_t* list_p) //N/A
+{
+	size_t node_size = list_p->node_size;
+	if (0 == count || count > (SIZE_MAX - sizeof(List_Node_Block)) / node_size)
+	{
+		return NULL;
+	}
+	List_Node_Block* block_p = malloc(sizeof(List_Node_Block) + count * node_size);
+	if (NULL == block_p)
+	{
+		return NULL;
+	}
+	atomic_init(&(block_p->refs), count);
+
+	//link everything in one pass
+	List_Node* previous_node = NULL;
+	for (size_t i = 0; i < count; i++)
+	{
+		List_Node* node_p = (List_Node*)(block_p->nodes + i * node_size);
+		node_p->data_p = (0 != list_p->elem_size) ? LIST_NODE_INLINE(node_p) : NULL;
+		node_p->next_p = NULL;
+		node_p->previous_p = previous_node;
+		node_p->block_p = block_p;
+		if (NULL != previous_node)
+		{
+			previous_node->next_p = node_p;
+		}
+		previous_node = node_p;
+	}
+	return (List_Node*)(block_p->nodes);
+}
+
+/*
+ *  @brief Check whether a node was carved from a list's own pool.
+ *  @param List_Node* The node in question.
+ *  @param List_t* The list the node belongs to.
+ *  @return bool True if the node lives inside the list's pool.
+ */
+static bool List_Node_Is_Pooled(List_Node* node_p, List_t* list_p) //N/A
+{
+	uintptr_t pool_start = (uintptr_t)(list_p->pool_p);
+	uintptr_t node = (uintptr_t)node_p;
+	return node >= pool_start && node < pool_start + list_p->pool_count * list_p->node_size;
+}
+
+/*
+ *  @brief Take an unused node from a list's pool.
+ *  @param List_t* The list whose pool to take from, its lock must be held.
+ *  @return List_Node* A pointer to an unlinked node with no data yet (besides its inline bytes for sized lists)
+ *	   or NULL when the pool is used up.
+ */
+static List_Node* List_Node_Pool_Take(List_t* list_p) //N/A
+{
+	List_Node* node_p = list_p->pool_free_p;
+	if (NULL != node_p)
+	{
+		list_p->pool_free_p = node_p->next_p;
+		list_p->pool_used++;
+		node_p->data_p = (0 != list_p->elem_size) ? LIST_NODE_INLINE(node_p) : NULL;
+		node_p->next_p = NULL;
+		node_p->previous_p = NULL;
+	}
+	return node_p;
+}
+
+/*
+ *  @brief Get a chain of nodes already linked to each other in order, from the list's pool when it has room
+ *	   for all of them and from a single new block otherwise.
+ *  @param size_t The number of nodes needed, must be at least 1.
+ *  @param List_t* The list the nodes are meant for, its lock must be held.
+ *  @return List_Node* A pointer to the first node of the chain or NULL on error.
+ */
+static List_Node* List_Node_Chain_Create(size_t count, List_t* list_p) //N/A
+{
+	if (count > list_p->pool_count - list_p->pool_used)
+	{
+		return list_p->in_buffer ? NULL : List_Node_Block_Create(count, list_p);
+	}
+	List_Node* first_p = NULL;
+	List_Node* previous_node = NULL;
+	for (size_t i = 0; i < count; i++)
+	{
+		List_Node* node_p = List_Node_Pool_Take(list_p);
+		node_p->previous_p = previous_node;
+		if (NULL != previous_node)
+		{
+			previous_node->next_p = node_p;
+		}
+		else
+		{
+			first_p = node_p;
+		}
+		previous_node = node_p;
+	}
+	return first_p;
+}
+
 /*
  *  @brief Get a pointer to the node at a given index in a given list.
  *  @param size_t The index of the node in question.
@@ -81,20 +321,25 @@ static List_Node* List_Node_At(size_t at, List_t* list_p) //N/A
 		return NULL;
 	}
 
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the correct index
-	for (size_t i = 0; i < at; i++)
+	//walk from whichever end of the list is closer
+	List_Node* current_node = NULL;
+	if (at <= list_p->length / 2)
 	{
-		//make sure the next node can be found
-		if (NULL != current_node)
+		//get the head node, an empty list will give NULL
+		current_node = list_p->head_p;
+		//loop till we are at the correct index
+		for (size_t i = 0; i < at && NULL != current_node; i++)
 		{
 			current_node = current_node->next_p;
 		}
-		else
+	}
+	else
+	{
+		current_node = list_p->tail_p;
+		//loop backwards till we are at the correct index
+		for (size_t i = list_p->length-1; i > at && NULL != current_node; i--)
 		{
-			//we have hit a dead end
-			break;
+			current_node = current_node->previous_p;
 		}
 	}
 
@@ -102,6 +347,90 @@ static List_Node* List_Node_At(size_t at, List_t* list_p) //N/A
 	return current_node;
 }
 
+/*
+ *  @brief Link a detached chain of nodes into a given list so that its first node lands at a given index.
+ *	   The caller is responsible for validating the index and any length limits.
+ *  @param List_Node* A pointer to the first node of the chain.
+ *  @param List_Node* A pointer to the last node of the chain.
+ *  @param size_t The number of nodes in the chain.
+ *  @param size_t The index the first node of the chain should occupy.
+ *  @param List_t* A pointer to the list that the chain should belong in.
+ *  @return void.
+ */
+static void List_Node_Link_Range(List_Node* first_p, List_Node* last_p, size_t count, size_t at, List_t* list_p) //N/A
+{
+	//find the nodes that will surround the chain, appending never needs a walk
+	List_Node* after_p = (at >= list_p->length) ? NULL : List_Node_At(at, list_p);
+	List_Node* before_p = (NULL == after_p) ? list_p->tail_p : after_p->previous_p;
+
+	//link the chain to its new neighbors
+	first_p->previous_p = before_p;
+	last_p->next_p = after_p;
+	//splice connections to the chain, updating head and tail if needed
+	if (NULL != before_p)
+	{
+		before_p->next_p = first_p;
+	}
+	else
+	{
+		list_p->head_p = first_p;
+	}
+	if (NULL != after_p)
+	{
+		after_p->previous_p = last_p;
+	}
+	else
+	{
+		list_p->tail_p = last_p;
+	}
+	list_p->length += count;
+	list_p->churn += count;
+}
+
+/*
+ *  @brief Detach a run of nodes from a given list, leaving them linked to each other.
+ *	   The caller is responsible for validating the range.
+ *  @param size_t The index of the first node to detach.
+ *  @param size_t The number of nodes to detach, must be at least 1.
+ *  @param List_t* A pointer to the list to detach nodes from.
+ *  @param List_Node** A pointer in which to put the first detached node.
+ *  @param List_Node** A pointer in which to put the last detached node.
+ *  @return void.
+ */
+static void List_Node_Unlink_Range(size_t from, size_t count, List_t* list_p, List_Node** first_pp, List_Node** last_pp) //N/A
+{
+	List_Node* first_p = List_Node_At(from, list_p);
+	List_Node* last_p = List_Node_At(from + count - 1, list_p);
+	List_Node* before_p = first_p->previous_p;
+	List_Node* after_p = last_p->next_p;
+
+	//close the gap left behind, updating head and tail if needed
+	if (NULL != before_p)
+	{
+		before_p->next_p = after_p;
+	}
+	else
+	{
+		list_p->head_p = after_p;
+	}
+	if (NULL != after_p)
+	{
+		after_p->previous_p = before_p;
+	}
+	else
+	{
+		list_p->tail_p = before_p;
+	}
+	list_p->length -= count;
+	list_p->churn += count;
+
+	//the chain no longer belongs to anything
+	first_p->previous_p = NULL;
+	last_p->next_p = NULL;
+	*first_pp = first_p;
+	*last_pp = last_p;
+}
+
 /*
  *  @brief Insert a node at a given index in a given list.
  *  @param size_t The index to put the given node at.
@@ -130,135 +459,76 @@ static List_Error_t List_Node_Insert(List_Node* node_p, size_t at, List_t* list_
 		ret_val = LIST_ERROR_EXCEED_LIMIT;
 		goto exit;
 	}
-	if (0 != list_p->length) //no need to update any other nodes
-	{
-		//find whos at "at" or the end if appending
-		if (list_p->length == at)
-		{
-			List_Node* tail_p = List_Node_At(at-1, list_p);
-			//check that tail exists
-			if (NULL != tail_p)
-			{
-				//link new node to its new neighbors
-				node_p->previous_p = tail_p;
-				//splice connections to new node
-				tail_p->next_p = node_p;
-			}
-		}
-		else
-		{
-			List_Node* replacee_p = List_Node_At(at, list_p);
-			//check that replacee exists
-			if (NULL != replacee_p)
-			{
-				//link new node to its new neighbors
-				node_p->next_p = replacee_p;
-				node_p->previous_p = replacee_p->previous_p;
-				//splice connections to new node
-				//make sure that there was a node before the replacee
-				if (NULL != replacee_p->previous_p)
-				{
-					replacee_p->previous_p->next_p = node_p;
-				}
-				replacee_p->previous_p = node_p;
-			}
-		}
-	}
-	//update head if needed
-	if (0 == at)
-	{
-		list_p->head_p = node_p;
-	}
-	//inc len
-	list_p->length++;
+	//a single node is just a chain of one
+	List_Node_Link_Range(node_p, node_p, 1, at, list_p);
 
 exit:
 	return ret_val;
 }
 
 /*
- *  @brief Destroy a given node. Note that this will only destroy the node and not the data within it
- *  @param List_Node* A pointer to the node to destroy.
- *  @return Void
+ *  @brief Lock two lists in a globally consistent order.
+ *	   Every operation that needs two lists locks them by ascending address so that two threads
+ *	   working on the same pair in opposite roles can never deadlock.
+ *  @param List_t* A pointer to the first list to lock.
+ *  @param List_t* A pointer to the second list to lock, must differ from the first.
+ *  @return void.
  */
-static void List_Node_Destroy(List_Node* node) //N/A
+static void List_Lock_Pair(List_t* list_a_p, List_t* list_b_p) //N/A
 {
-	//check params
-	if (NULL != node)
+	if ((uintptr_t)list_a_p < (uintptr_t)list_b_p)
 	{
-		free(node); //setting to null here does nothing
+		pthread_mutex_lock(&(list_a_p->lock));
+		pthread_mutex_lock(&(list_b_p->lock));
+	}
+	else
+	{
+		pthread_mutex_lock(&(list_b_p->lock));
+		pthread_mutex_lock(&(list_a_p->lock));
 	}
 }
 
 /*
- *  @brief Check a list for sortedness. 
- *  @param List_t* A pointer to the list to check for sortedness.
-			A list is considered sorted when each node's precedence is ordered from high to low
- *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use during sorting.
-						If NULL is used here, the list's default cmp function will be used
- *  @return bool True if sorted fully, false otherwise
+ *  @brief Unlock two lists previously locked with List_Lock_Pair.
+ *  @param List_t* A pointer to the first list to unlock.
+ *  @param List_t* A pointer to the second list to unlock.
+ *  @return void.
  */
-static bool List_Is_Sorted(List_t* list_p, List_Cmp_Fnc cmp_fnc) //N/A
+static void List_Unlock_Pair(List_t* list_a_p, List_t* list_b_p) //N/A
 {
-	//check params
-	if (NULL == list_p)
-	{
-		return LIST_ERROR_INVALID_PARAM;
-	}
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the second to last
-	for (size_t i = 0; i < list_p->length-1 && NULL != current_node; i++)
-	{
-		//compare current and next node
-		int node_cmp = 0;
-		if (NULL == cmp_fnc && NULL != list_p->cmp)
-		{
-			node_cmp = list_p->cmp(
-				current_node->data_p,
-				current_node->next_p->data_p
-			);
-		}
-		else if (NULL != cmp_fnc)
-		{
-			node_cmp = cmp_fnc(
-				current_node->data_p,
-				current_node->next_p->data_p
-			);
-		}
-		if (0 > node_cmp)
-		{
-			return false;
-		}
-
-		current_node = current_node->next_p;
-	}
-	return true;
+	pthread_mutex_unlock(&(list_a_p->lock));
+	pthread_mutex_unlock(&(list_b_p->lock));
 }
 
 /*
- *  @brief Swap the data of two given nodes.
- *  @param List_Node* A pointer to the first node to swap.
- *  @param List_Node* A pointer to the second node to swap.
- *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *  @brief Destroy a given node. Note that this will only destroy the node and not the data within it
+ *  @param List_Node* A pointer to the node to destroy.
+ *  @param List_t* A pointer to the list the node was made for, pool nodes go back to its pool.
+ *  @return Void
  */
-static List_Error_t List_Node_Swap(List_Node* node_a, List_Node* node_b) //N/A
+static void List_Node_Destroy(List_Node* node, List_t* list_p) //N/A
 {
 	//check params
-	if (NULL == node_a || NULL == node_b)
+	if (NULL == node)
 	{
-		return LIST_ERROR_INVALID_PARAM;
+		return;
+	}
+	if (List_Node_Is_Pooled(node, list_p))
+	{
+		node->data_p = NULL;
+		node->next_p = list_p->pool_free_p;
+		list_p->pool_free_p = node;
+		list_p->pool_used--;
+	}
+	else if (NULL == node->block_p)
+	{
+		free(node); //setting to null here does nothing
+	}
+	//the last node out frees the block, wherever its siblings ended up
+	else if (1 == atomic_fetch_sub(&(node->block_p->refs), 1))
+	{
+		free(node->block_p);
 	}
-
-	//store tmp vals for swap
-	List_Node* tmp_data_p = node_a->data_p;
-
-	//change a's neighbors
-	node_a->data_p = node_b->data_p;
-
-	node_b->data_p = tmp_data_p;
-
-	return LIST_ERROR_SUCCESS;
 }
 
 /*
@@ -289,930 +559,5482 @@ static List_Error_t List_Node_Remove(List_Node* node, List_t* list_p) //N/A
 	}
 	//update list size
 	list_p->length--;
-	//update head if needed
+	list_p->churn++;
+	//update head and tail if needed
 	if (list_p->head_p == node)
 	{
 		list_p->head_p = after_node;
 	}
+	if (list_p->tail_p == node)
+	{
+		list_p->tail_p = before_node;
+	}
 
-	List_Node_Destroy(node);
+	List_Node_Destroy(node, list_p);
 	return LIST_ERROR_SUCCESS;
 }
 
 /*
- *  @brief Create an empty list.
- *  @param size_t The maximum size to allow the list to grow.
-					If 0 is passed as this value, no maximum will be enforced (Not recommended!)
- *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
- *	   Passing NULL here will cause each member to have the same precedence.
- *  @param List_Free_Fnc A function used when freeing data within the list.
- *  @return List_t* A pointer to the allocated list or NULL on error.
+ *  @brief Get the slot at a given index in an index storage list.
+ *  @param size_t The index of the slot in question.
+ *  @param List_t* A pointer to the list that contains the slot in question.
+ *  @return uint32_t The slot at the given index or LIST_INDEX_NONE on error.
  */
-List_t* List_Create(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free) //N/A
+static uint32_t List_Index_At(size_t at, List_t* list_p) //N/A
 {
-	if (NULL == free)
+	if (at >= list_p->length)
 	{
-		return NULL;
+		return LIST_INDEX_NONE;
 	}
-	List_t* new_list_p = malloc(sizeof(List_t));
-	if (NULL != new_list_p)
-	{
-		new_list_p->length = 0;
-		new_list_p->max_length = max_length;
-		new_list_p->head_p = NULL;
-		new_list_p->cmp = cmp;
-		new_list_p->free = free;
 
-		int lock_created = pthread_mutex_init(&(new_list_p->lock), NULL);
-		if (lock_created != 0)
+	//walk from whichever end of the list is closer
+	uint32_t slot = LIST_INDEX_NONE;
+	if (at <= list_p->length / 2)
+	{
+		slot = list_p->head_slot;
+		for (size_t i = 0; i < at && LIST_INDEX_NONE != slot; i++)
 		{
-			free(new_list_p);
-			new_list_p = NULL;
+			slot = LIST_SLOT_LINKS(list_p, slot)->next;
 		}
 	}
-	return new_list_p;
+	else
+	{
+		slot = list_p->tail_slot;
+		for (size_t i = list_p->length-1; i > at && LIST_INDEX_NONE != slot; i--)
+		{
+			slot = LIST_SLOT_LINKS(list_p, slot)->previous;
+		}
+	}
+	return slot;
 }
 
 /*
- *  @brief Copy that the given list is valid.
- *  @param List_t* The list to copy.
- *  @param List_Copy_Fnc A user provided function to copy node values.
-			If Null is passed, a shallow copy will be formed where:
-				Each node value is the same pointer
-				The list itself will be in different
- *  @return List_t* A pointer to the allocated list or NULL on error.
+ *  @brief Work out how many slots an index or ring storage list should grow to.
+ *	   The slot count doubles but never goes past the list's max length or a limit of its storage.
+ *  @param size_t The number of slots needed, more than the list has.
+ *  @param size_t The most slots the storage can address.
+ *  @param List_t* A pointer to the list that is growing.
+ *  @return size_t The new number of slots, at least the number needed.
  */
-List_t* List_Copy(List_t* list_p, List_Copy_Fnc copy_node_fnc) //safe
+static size_t List_Slots_Grow(size_t needed, size_t limit, List_t* list_p) //N/A
 {
-	//check params
-	if (NULL == list_p)
+	//no point growing past what the list may ever hold
+	if (0 != list_p->max_length && list_p->max_length < limit)
 	{
-		return NULL;
+		limit = list_p->max_length;
 	}
-
-	pthread_mutex_lock(&(list_p->lock));
-
-	List_t* copy_list = List_Create(list_p->max_length, list_p->cmp, list_p->free);
-	if (NULL == copy_list)
+	size_t capacity = (0 != list_p->slot_capacity) ? list_p->slot_capacity : LIST_INDEX_MIN_SLOTS;
+	while (capacity < needed && capacity <= limit / 2)
 	{
-		goto exit;
+		capacity *= 2;
 	}
-	
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the end
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+	if (capacity < needed || capacity > limit)
 	{
-		List_Error_t could_push;
-		if (NULL == copy_node_fnc)
-		{
-			could_push = List_Push(current_node->data_p, copy_list);
-		}
-		else
-		{
-			could_push = List_Push(copy_node_fnc(current_node->data_p), copy_list);
-		}
-
-		if (LIST_ERROR_SUCCESS != could_push)
-		{
-			List_Destroy(copy_list);
-			copy_list = NULL;
-			goto exit;
-		}
-
-		current_node = current_node->next_p;
+		capacity = limit;
 	}
-
-exit:
-	pthread_mutex_unlock(&(list_p->lock));
-	return copy_list;
+	if (capacity < needed)
+	{
+		capacity = needed;
+	}
+	return capacity;
 }
 
 /*
- *  @brief Verify that the given list is valid.
- *  @param List_t* The list to verify.
- *  @param List_Find_Fnc A user provided function to cehck validity of list values.
-			If Null is passed, this will not be used and only metadata will be validated.
- *  @return List_Error_t LIST_ERROR_SUCCESS if the list is valid or an error attempting to describe the failure.
+ *  @brief Make sure a number of slots can be handed out of an index storage list without allocating.
+ *	   The slot array grows geometrically but never past the list's max length or the number of 32 bit slots.
+ *  @param size_t The number of slots needed on top of those holding elements.
+ *  @param List_t* A pointer to the list to reserve slots in.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Error_t List_Verify(List_t* list_p, List_Find_Fnc valid_check) //safe
+static List_Error_t List_Index_Reserve(size_t count, List_t* list_p) //N/A
 {
-	//check params
-	if (NULL == list_p)
+	if (count > LIST_INDEX_MAX_SLOTS - list_p->length)
 	{
-		return LIST_ERROR_INVALID_PARAM;
+		return LIST_ERROR_EXCEED_LIMIT;
 	}
+	size_t needed = list_p->length + count;
+	if (needed <= list_p->slot_capacity)
+	{
+		return LIST_ERROR_SUCCESS;
+	}
+
+	size_t capacity = List_Slots_Grow(needed, LIST_INDEX_MAX_SLOTS, list_p);
+	if (capacity > SIZE_MAX / list_p->node_size)
+	{
+		return LIST_ERROR_FAILURE;
+	}
+
+	unsigned char* slots_p = realloc(list_p->slots_p, capacity * list_p->node_size);
+	if (NULL == slots_p)
+	{
+		return LIST_ERROR_FAILURE;
+	}
+	list_p->slots_p = slots_p;
+	list_p->slot_capacity = capacity;
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Hand out an unused slot of an index storage list, reusing freed slots first.
+ *	   Room must already have been made with List_Index_Reserve.
+ *  @param List_t* A pointer to the list to take a slot from.
+ *  @return uint32_t The slot, which is not linked to anything yet.
+ */
+static uint32_t List_Index_Slot_Alloc(List_t* list_p) //N/A
+{
+	uint32_t slot = list_p->free_slot;
+	if (LIST_INDEX_NONE != slot)
+	{
+		list_p->free_slot = LIST_SLOT_LINKS(list_p, slot)->next;
+	}
+	else
+	{
+		slot = (uint32_t)(list_p->slot_count++);
+	}
+	return slot;
+}
+
+/*
+ *  @brief Give an unlinked slot back to the free slots of an index storage list.
+ *  @param uint32_t The slot to free.
+ *  @param List_t* A pointer to the list the slot belongs to.
+ *  @return void.
+ */
+static void List_Index_Slot_Free(uint32_t slot, List_t* list_p) //N/A
+{
+	LIST_SLOT_LINKS(list_p, slot)->next = list_p->free_slot;
+	list_p->free_slot = slot;
+}
+
+/*
+ *  @brief Link a detached chain of slots into an index storage list so that its first slot lands at a given index.
+ *	   The caller is responsible for validating the index and any length limits.
+ *  @param uint32_t The first slot of the chain.
+ *  @param uint32_t The last slot of the chain.
+ *  @param size_t The number of slots in the chain.
+ *  @param size_t The index the first slot of the chain should occupy.
+ *  @param List_t* A pointer to the list the chain belongs to.
+ *  @return void.
+ */
+static void List_Index_Link_Range(uint32_t first, uint32_t last, size_t count, size_t at, List_t* list_p) //N/A
+{
+	//find the slots that will surround the chain, appending never needs a walk
+	uint32_t after = (at >= list_p->length) ? LIST_INDEX_NONE : List_Index_At(at, list_p);
+	uint32_t before = (LIST_INDEX_NONE == after) ? list_p->tail_slot : LIST_SLOT_LINKS(list_p, after)->previous;
+
+	LIST_SLOT_LINKS(list_p, first)->previous = before;
+	LIST_SLOT_LINKS(list_p, last)->next = after;
+	if (LIST_INDEX_NONE != before)
+	{
+		LIST_SLOT_LINKS(list_p, before)->next = first;
+	}
+	else
+	{
+		list_p->head_slot = first;
+	}
+	if (LIST_INDEX_NONE != after)
+	{
+		LIST_SLOT_LINKS(list_p, after)->previous = last;
+	}
+	else
+	{
+		list_p->tail_slot = last;
+	}
+	list_p->length += count;
+	list_p->churn += count;
+}
+
+/*
+ *  @brief Unlink a slot from an index storage list without freeing it.
+ *  @param uint32_t The slot to unlink.
+ *  @param List_t* A pointer to the list that contains the slot.
+ *  @return void.
+ */
+static void List_Index_Unlink(uint32_t slot, List_t* list_p) //N/A
+{
+	List_Index_Links* links_p = LIST_SLOT_LINKS(list_p, slot);
+	if (LIST_INDEX_NONE != links_p->previous)
+	{
+		LIST_SLOT_LINKS(list_p, links_p->previous)->next = links_p->next;
+	}
+	else
+	{
+		list_p->head_slot = links_p->next;
+	}
+	if (LIST_INDEX_NONE != links_p->next)
+	{
+		LIST_SLOT_LINKS(list_p, links_p->next)->previous = links_p->previous;
+	}
+	else
+	{
+		list_p->tail_slot = links_p->previous;
+	}
+	list_p->length--;
+	list_p->churn++;
+}
+
+/*
+ *  @brief Free the slot array of an index or ring storage list, leaving it empty.
+ *	   The elements themselves are not freed.
+ *  @param List_t* A pointer to the list to release.
+ *  @return void.
+ */
+static void List_Index_Release(List_t* list_p) //N/A
+{
+	free(list_p->slots_p);
+	list_p->slots_p = NULL;
+	list_p->slot_capacity = 0;
+	list_p->slot_count = 0;
+	list_p->head_slot = LIST_INDEX_NONE;
+	list_p->tail_slot = LIST_INDEX_NONE;
+	list_p->free_slot = LIST_INDEX_NONE;
+	list_p->ring_head = 0;
+	list_p->length = 0;
+}
+
+/*
+ *  @brief Move every element of an index storage list into a new, exactly sized slot array laid out in list order.
+ *  @param List_t* A pointer to the list to compact, its lock must be held.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *	   The list is untouched if the new array cant be allocated.
+ */
+static List_Error_t List_Index_Compact(List_t* list_p) //N/A
+{
+	size_t count = list_p->length;
+	unsigned char* slots_p = NULL;
+	if (0 != count)
+	{
+		slots_p = malloc(count * list_p->node_size);
+		if (NULL == slots_p)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		uint32_t slot = list_p->head_slot;
+		for (size_t i = 0; i < count && LIST_INDEX_NONE != slot; i++)
+		{
+			unsigned char* new_slot_p = slots_p + i * list_p->node_size;
+			memcpy(new_slot_p, LIST_SLOT(list_p, slot), list_p->links_offset);
+			List_Index_Links* links_p = (List_Index_Links*)(new_slot_p + list_p->links_offset);
+			links_p->previous = (0 < i) ? (uint32_t)(i - 1) : LIST_INDEX_NONE;
+			links_p->next = (i + 1 < count) ? (uint32_t)(i + 1) : LIST_INDEX_NONE;
+			slot = LIST_SLOT_LINKS(list_p, slot)->next;
+		}
+	}
+	free(list_p->slots_p);
+	list_p->slots_p = slots_p;
+	list_p->slot_capacity = count;
+	list_p->slot_count = count;
+	list_p->head_slot = (0 != count) ? 0 : LIST_INDEX_NONE;
+	list_p->tail_slot = (0 != count) ? (uint32_t)(count - 1) : LIST_INDEX_NONE;
+	list_p->free_slot = LIST_INDEX_NONE;
+	list_p->churn = 0;
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Get the slot holding the element at a given index of a ring storage list.
+ *  @param size_t The index in question, which may be past the list's length but not its capacity.
+ *  @param List_t* A pointer to the list in question.
+ *  @return unsigned char* The slot, wrapped around to the start of the array if need be.
+ */
+static unsigned char* List_Ring_Slot(size_t at, List_t* list_p) //N/A
+{
+	size_t slot = list_p->ring_head + at;
+	if (slot >= list_p->slot_capacity)
+	{
+		slot -= list_p->slot_capacity;
+	}
+	return LIST_SLOT(list_p, slot);
+}
+
+/*
+ *  @brief Copy every element of a ring storage list, in list order, into a flat array.
+ *  @param unsigned char* Room for the list's length worth of slots.
+ *  @param List_t* A pointer to the list to copy from.
+ *  @return void.
+ */
+static void List_Ring_Flatten(unsigned char* dest_p, List_t* list_p) //N/A
+{
+	if (0 == list_p->length)
+	{
+		return;
+	}
+	//at most two runs, the one up to the end of the array and the one that wrapped around
+	size_t first_run = list_p->slot_capacity - list_p->ring_head;
+	if (first_run > list_p->length)
+	{
+		first_run = list_p->length;
+	}
+	memcpy(dest_p, LIST_SLOT(list_p, list_p->ring_head), first_run * list_p->node_size);
+	memcpy(dest_p + first_run * list_p->node_size, list_p->slots_p, (list_p->length - first_run) * list_p->node_size);
+}
+
+/*
+ *  @brief Move the elements of a ring storage list into a new array of a given size, starting at its first slot.
+ *  @param size_t The number of slots the new array should have, at least the list's length.
+ *  @param List_t* A pointer to the list to resize.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *	   The list is untouched if the new array cant be allocated.
+ */
+static List_Error_t List_Ring_Resize(size_t capacity, List_t* list_p) //N/A
+{
+	unsigned char* slots_p = NULL;
+	if (0 != capacity)
+	{
+		if (capacity > SIZE_MAX / list_p->node_size)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		slots_p = malloc(capacity * list_p->node_size);
+		if (NULL == slots_p)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		List_Ring_Flatten(slots_p, list_p);
+	}
+	free(list_p->slots_p);
+	list_p->slots_p = slots_p;
+	list_p->slot_capacity = capacity;
+	list_p->ring_head = 0;
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Move a run of elements of a ring storage list to another index, one slot at a time.
+ *	   The slots the run is moved out of are left as they were.
+ *  @param size_t The index of the first element to move.
+ *  @param size_t The index the first element should end up at.
+ *  @param size_t The number of elements to move.
+ *  @param List_t* A pointer to the list in question.
+ *  @return void.
+ */
+static void List_Ring_Shift(size_t from, size_t to, size_t count, List_t* list_p) //N/A
+{
+	//copy in the direction that never overwrites an element before it has moved
+	if (to < from)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(List_Ring_Slot(to + i, list_p), List_Ring_Slot(from + i, list_p), list_p->node_size);
+		}
+	}
+	else if (to > from)
+	{
+		for (size_t i = count; i > 0; i--)
+		{
+			memcpy(List_Ring_Slot(to + i - 1, list_p), List_Ring_Slot(from + i - 1, list_p), list_p->node_size);
+		}
+	}
+}
+
+/*
+ *  @brief Open a gap of unused slots at a given index of a ring storage list, growing the array if need be.
+ *	   Whichever side of the index holds fewer elements is the side that moves, so both ends take O(1).
+ *	   The caller is responsible for validating the index and any length limits and for filling the gap.
+ *  @param size_t The index the first slot of the gap should have.
+ *  @param size_t The number of slots to open up.
+ *  @param List_t* A pointer to the list to open a gap in.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Ring_Open(size_t at, size_t count, List_t* list_p) //N/A
+{
+	if (count > SIZE_MAX - list_p->length)
+	{
+		return LIST_ERROR_EXCEED_LIMIT;
+	}
+	size_t needed = list_p->length + count;
+	if (needed > list_p->slot_capacity)
+	{
+		List_Error_t ret_val = List_Ring_Resize(List_Slots_Grow(needed, SIZE_MAX, list_p), list_p);
+		if (LIST_ERROR_SUCCESS != ret_val)
+		{
+			return ret_val;
+		}
+	}
+	if (at < list_p->length - at)
+	{
+		//everything before the gap steps back by count
+		list_p->ring_head += list_p->slot_capacity - count;
+		if (list_p->ring_head >= list_p->slot_capacity)
+		{
+			list_p->ring_head -= list_p->slot_capacity;
+		}
+		List_Ring_Shift(count, 0, at, list_p);
+	}
+	else
+	{
+		List_Ring_Shift(at, at + count, list_p->length - at, list_p);
+	}
+	list_p->length += count;
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Remove a run of elements from a ring storage list, closing the gap from whichever side is shorter.
+ *	   The elements themselves are not freed.
+ *  @param size_t The index of the first element to remove.
+ *  @param size_t The number of elements to remove, which must all be in the list.
+ *  @param List_t* A pointer to the list to remove from.
+ *  @return void.
+ */
+static void List_Ring_Erase(size_t at, size_t count, List_t* list_p) //N/A
+{
+	if (at < list_p->length - at - count)
+	{
+		//everything before the gap steps forward by count
+		List_Ring_Shift(0, count, at, list_p);
+		list_p->ring_head += count;
+		if (list_p->ring_head >= list_p->slot_capacity)
+		{
+			list_p->ring_head -= list_p->slot_capacity;
+		}
+	}
+	else
+	{
+		List_Ring_Shift(at + count, at, list_p->length - at - count, list_p);
+	}
+	list_p->length -= count;
+}
+
+/*
+ *  @brief Swap two elements of a ring storage list.
+ *  @param size_t The index of one element.
+ *  @param size_t The index of the other element.
+ *  @param List_t* A pointer to the list in question.
+ *  @return void.
+ */
+static void List_Ring_Swap(size_t a, size_t b, List_t* list_p) //N/A
+{
+	unsigned char* a_p = List_Ring_Slot(a, list_p);
+	unsigned char* b_p = List_Ring_Slot(b, list_p);
+	if (0 == list_p->elem_size)
+	{
+		void* tmp_p = *(void**)a_p;
+		*(void**)a_p = *(void**)b_p;
+		*(void**)b_p = tmp_p;
+		return;
+	}
+	//swap a byte at a time, inline elements may be any size
+	for (size_t i = 0; i < list_p->node_size; i++)
+	{
+		unsigned char tmp = a_p[i];
+		a_p[i] = b_p[i];
+		b_p[i] = tmp;
+	}
+}
+
+/*
+ *  @brief Reverse the order of a run of elements of a ring storage list in place.
+ *  @param size_t The index of the first element of the run.
+ *  @param size_t The number of elements in the run.
+ *  @param List_t* A pointer to the list in question.
+ *  @return void.
+ */
+static void List_Ring_Reverse(size_t at, size_t count, List_t* list_p) //N/A
+{
+	for (size_t i = 0; i < count / 2; i++)
+	{
+		List_Ring_Swap(at + i, at + count - 1 - i, list_p);
+	}
+}
+
+/*
+ *  @brief Move a single element of a ring storage list to another index, shifting everything between over by one.
+ *  @param size_t The index of the element to move.
+ *  @param size_t The index the element should end up at.
+ *  @param List_t* A pointer to the list in question.
+ *  @return void.
+ */
+static void List_Ring_Rotate(size_t from, size_t to, List_t* list_p) //N/A
+{
+	//two reversals rotate the run between the indices by one
+	if (from < to)
+	{
+		List_Ring_Reverse(from + 1, to - from, list_p);
+		List_Ring_Reverse(from, to - from + 1, list_p);
+	}
+	else if (to < from)
+	{
+		List_Ring_Reverse(to, from - to, list_p);
+		List_Ring_Reverse(to, from - to + 1, list_p);
+	}
+}
+
+/*
+ *  @brief Get the data of the element at a given index of a ring storage list.
+ *  @param size_t The index in question.
+ *  @param List_t* A pointer to the list in question.
+ *  @return void* The caller's pointer, or a pointer to the inline element for sized lists.
+ */
+static void* List_Ring_Data(size_t at, List_t* list_p) //N/A
+{
+	unsigned char* slot_p = List_Ring_Slot(at, list_p);
+	return (0 != list_p->elem_size) ? (void*)slot_p : *(void**)slot_p;
+}
+
+/*
+ *  @brief Move an element of a heap up towards the root until its parent has at least its precedence.
+ *  @param size_t The index of the element to move.
+ *  @param List_t* A pointer to the heap in question.
+ *  @return void.
+ */
+static void List_Heap_Sift_Up(size_t at, List_t* list_p) //N/A
+{
+	while (0 < at)
+	{
+		size_t parent = (at - 1) / 2;
+		if (0 >= list_p->cmp(List_Ring_Data(at, list_p), List_Ring_Data(parent, list_p)))
+		{
+			break;
+		}
+		List_Ring_Swap(at, parent, list_p);
+		at = parent;
+	}
+}
+
+/*
+ *  @brief Move an element of a heap down towards the leaves until neither child has more precedence.
+ *  @param size_t The index of the element to move.
+ *  @param size_t The number of elements making up the heap, which may be fewer than the list holds.
+ *  @param List_t* A pointer to the heap in question.
+ *  @return void.
+ */
+static void List_Heap_Sift_Down(size_t at, size_t count, List_t* list_p) //N/A
+{
+	while (at < count / 2)
+	{
+		//every index below count / 2 has at least a left child
+		size_t child = 2 * at + 1;
+		if (child + 1 < count && 0 < list_p->cmp(List_Ring_Data(child + 1, list_p), List_Ring_Data(child, list_p)))
+		{
+			child++;
+		}
+		if (0 >= list_p->cmp(List_Ring_Data(child, list_p), List_Ring_Data(at, list_p)))
+		{
+			break;
+		}
+		List_Ring_Swap(at, child, list_p);
+		at = child;
+	}
+}
+
+/*
+ *  @brief Rearrange every element of a heap so that it is a heap again, in O(n).
+ *  @param List_t* A pointer to the heap in question.
+ *  @return void.
+ */
+static void List_Heap_Build(List_t* list_p) //N/A
+{
+	for (size_t i = list_p->length / 2; i > 0; i--)
+	{
+		List_Heap_Sift_Down(i - 1, list_p->length, list_p);
+	}
+}
+
+/*
+ *  @brief Remove the element at a given index of a heap, putting the last element in its place.
+ *	   The element itself is not freed.
+ *  @param size_t The index of the element to remove.
+ *  @param List_t* A pointer to the heap in question.
+ *  @return void.
+ */
+static void List_Heap_Remove(size_t at, List_t* list_p) //N/A
+{
+	size_t last = list_p->length - 1;
+	if (at != last)
+	{
+		List_Ring_Swap(at, last, list_p);
+	}
+	List_Ring_Erase(last, 1, list_p);
+	//the moved element may belong further up or further down
+	if (at < list_p->length)
+	{
+		List_Heap_Sift_Down(at, list_p->length, list_p);
+		List_Heap_Sift_Up(at, list_p);
+	}
+}
+
+/*
+ *  @brief Get the position of the first element of a list as it is laid out, whichever way it reads.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The position of the first element laid out or LIST_POS_NONE if the list is empty.
+ */
+static List_Pos List_Pos_Head(List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		return LIST_POS_OF_SLOT(list_p->head_slot);
+	}
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		return (0 != list_p->length) ? LIST_POS_OF_RING(0) : LIST_POS_NONE;
+	}
+	return (List_Pos)(list_p->head_p);
+}
+
+/*
+ *  @brief Get the position of the last element of a list as it is laid out, whichever way it reads.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The position of the last element laid out or LIST_POS_NONE if the list is empty.
+ */
+static List_Pos List_Pos_Tail(List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		return LIST_POS_OF_SLOT(list_p->tail_slot);
+	}
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		//the position of the last element is the length, which is also none for an empty list
+		return (List_Pos)(list_p->length);
+	}
+	return (List_Pos)(list_p->tail_p);
+}
+
+/*
+ *  @brief Step to the position laid out after a given one, whichever way the list reads.
+ *  @param List_Pos A valid position in the list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The following position or LIST_POS_NONE past the tail of the list.
+ */
+static List_Pos List_Pos_Forward(List_Pos pos, List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		return LIST_POS_OF_SLOT(LIST_SLOT_LINKS(list_p, LIST_SLOT_OF_POS(pos))->next);
+	}
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		return (pos < list_p->length) ? pos + 1 : LIST_POS_NONE;
+	}
+	return (List_Pos)(((List_Node*)pos)->next_p);
+}
+
+/*
+ *  @brief Step to the position laid out before a given one, whichever way the list reads.
+ *  @param List_Pos A valid position in the list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The preceding position or LIST_POS_NONE before the head of the list.
+ */
+static List_Pos List_Pos_Backward(List_Pos pos, List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		return LIST_POS_OF_SLOT(LIST_SLOT_LINKS(list_p, LIST_SLOT_OF_POS(pos))->previous);
+	}
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		return pos - 1;
+	}
+	return (List_Pos)(((List_Node*)pos)->previous_p);
+}
+
+/*
+ *  @brief Get the position of the first element of a list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The position of the first element or LIST_POS_NONE if the list is empty.
+ */
+static List_Pos List_Pos_First(List_t* list_p) //N/A
+{
+	return list_p->reversed ? List_Pos_Tail(list_p) : List_Pos_Head(list_p);
+}
+
+/*
+ *  @brief Get the position of the last element of a list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The position of the last element or LIST_POS_NONE if the list is empty.
+ */
+static List_Pos List_Pos_Last(List_t* list_p) //N/A
+{
+	return list_p->reversed ? List_Pos_Head(list_p) : List_Pos_Tail(list_p);
+}
+
+/*
+ *  @brief Step to the position after a given one.
+ *  @param List_Pos A valid position in the list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The next position or LIST_POS_NONE at the end of the list.
+ */
+static List_Pos List_Pos_Next(List_Pos pos, List_t* list_p) //N/A
+{
+	return list_p->reversed ? List_Pos_Backward(pos, list_p) : List_Pos_Forward(pos, list_p);
+}
+
+/*
+ *  @brief Step to the position before a given one.
+ *  @param List_Pos A valid position in the list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The previous position or LIST_POS_NONE at the start of the list.
+ */
+static List_Pos List_Pos_Prev(List_Pos pos, List_t* list_p) //N/A
+{
+	return list_p->reversed ? List_Pos_Forward(pos, list_p) : List_Pos_Backward(pos, list_p);
+}
+
+/*
+ *  @brief Get where an index of a list is laid out, counting from the head whichever way the list reads.
+ *  @param size_t The index in question, or the length for the end of the list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return size_t The index laid out, any index past the length is given back as is.
+ */
+static size_t List_Laid_Out_At(size_t at, List_t* list_p) //N/A
+{
+	return (list_p->reversed && at < list_p->length) ? list_p->length - 1 - at : at;
+}
+
+/*
+ *  @brief Get where an element inserted at an index of a list goes, counting from the head whichever way the list reads.
+ *  @param size_t The index the element should occupy, up to the length.
+ *  @param List_t* A pointer to the list in question.
+ *  @return size_t The index to insert at laid out, any index past the length is given back as is.
+ */
+static size_t List_Laid_Out_Insert_At(size_t at, List_t* list_p) //N/A
+{
+	return (list_p->reversed && at <= list_p->length) ? list_p->length - at : at;
+}
+
+/*
+ *  @brief Get the position at a given index in a list.
+ *  @param size_t The index in question.
+ *  @param List_t* A pointer to the list in question.
+ *  @return List_Pos The position at the given index or LIST_POS_NONE on error.
+ */
+static List_Pos List_Pos_At(size_t at, List_t* list_p) //N/A
+{
+	at = List_Laid_Out_At(at, list_p);
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		return LIST_POS_OF_SLOT(List_Index_At(at, list_p));
+	}
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		return (at < list_p->length) ? LIST_POS_OF_RING(at) : LIST_POS_NONE;
+	}
+	return (List_Pos)List_Node_At(at, list_p);
+}
+
+/*
+ *  @brief Get the data held at a given position.
+ *  @param List_Pos A valid position in the list.
+ *  @param List_t* A pointer to the list in question.
+ *  @return void* The caller's pointer, or a pointer to the inline element for sized lists.
+ */
+static void* List_Pos_Data(List_Pos pos, List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_NODES != list_p->storage)
+	{
+		unsigned char* slot_p = (LIST_STORAGE_INDEX == list_p->storage)
+			? LIST_SLOT(list_p, LIST_SLOT_OF_POS(pos)) : List_Ring_Slot(LIST_RING_OF_POS(pos), list_p);
+		return (0 != list_p->elem_size) ? (void*)slot_p : *(void**)slot_p;
+	}
+	return ((List_Node*)pos)->data_p;
+}
+
+/*
+ *  @brief Put data at a given position, copying the element in for sized lists.
+ *  @param List_Pos A valid position, which may belong to a chain not yet linked into the list.
+ *  @param void* The data to store.
+ *  @param List_t* A pointer to the list the position belongs to.
+ *  @return void.
+ */
+static void List_Pos_Store(List_Pos pos, void* data_p, List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_NODES != list_p->storage)
+	{
+		unsigned char* slot_p = (LIST_STORAGE_INDEX == list_p->storage)
+			? LIST_SLOT(list_p, LIST_SLOT_OF_POS(pos)) : List_Ring_Slot(LIST_RING_OF_POS(pos), list_p);
+		if (0 != list_p->elem_size)
+		{
+			memcpy(slot_p, data_p, list_p->elem_size);
+		}
+		else
+		{
+			*(void**)slot_p = data_p;
+		}
+		return;
+	}
+	List_Node* node_p = (List_Node*)pos;
+	if (0 != list_p->elem_size)
+	{
+		memcpy(node_p->data_p, data_p, list_p->elem_size);
+	}
+	else
+	{
+		node_p->data_p = data_p;
+	}
+}
+
+/*
+ *  @brief Remove the element at a given position from a list.
+ *     Note that this frees the node or slot BUT WILL NOT free the data held there.
+ *  @param List_Pos The position to remove.
+ *  @param List_t* A pointer to the list that contains the position.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Pos_Remove(List_Pos pos, List_t* list_p) //N/A
+{
+	if (LIST_POS_NONE == pos)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		List_Index_Unlink(LIST_SLOT_OF_POS(pos), list_p);
+		List_Index_Slot_Free(LIST_SLOT_OF_POS(pos), list_p);
+		return LIST_ERROR_SUCCESS;
+	}
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		if (list_p->heap)
+		{
+			List_Heap_Remove(LIST_RING_OF_POS(pos), list_p);
+		}
+		else
+		{
+			List_Ring_Erase(LIST_RING_OF_POS(pos), 1, list_p);
+		}
+		return LIST_ERROR_SUCCESS;
+	}
+	return List_Node_Remove((List_Node*)pos, list_p);
+}
+
+/*
+ *  @brief Free a caller pointer a list no longer holds, if the list frees its values at all.
+ *	   Copy on write clones have no free function, their values belong to the list they were cloned from.
+ *  @param void* The value to free.
+ *  @param List_t* A pointer to the list that held it.
+ *  @return void.
+ */
+static void List_Value_Free(void* data_p, List_t* list_p) //N/A
+{
+	if (0 == list_p->elem_size && NULL != list_p->free)
+	{
+		list_p->free(data_p);
+	}
+}
+
+/*
+ *  @brief Remove the element at a given position from a list and destroy the data held within it.
+ *     Data stored inline in sized lists goes away with its node or slot, the free function is only used on caller pointers.
+ *  @param List_Pos The position to delete.
+ *  @param List_t* A pointer to the list that contains the position.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Pos_Delete(List_Pos pos, List_t* list_p) //N/A
+{
+	if (LIST_POS_NONE == pos)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	void* data_p = List_Pos_Data(pos, list_p);
+	List_Error_t ret_val = List_Pos_Remove(pos, list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		List_Value_Free(data_p, list_p);
+	}
+	return ret_val;
+}
+
+/*
+ *  @brief A walk over a run of positions, with a second cursor running the list's prefetch distance ahead of it.
+ *	   The cursor ahead fetches the nodes or slots it reaches and the caller data of those it passes,
+ *	   so they are already on their way into cache when the walk gets to them.
+ */
+typedef struct List_Walk
+{
+	List_t* list_p;
+	List_Pos pos; //where the walk is
+	List_Pos ahead_pos; //where the cursor ahead is
+	size_t ahead_left; //positions of the run past ahead_pos, the cursor ahead stops when there are none
+}
+List_Walk;
+
+/*
+ *  @brief Fetch what the cursor ahead of a walk has just reached.
+ *	   The node it reached is only now known, so only it can be fetched, but the node it left was fetched a step ago,
+ *	   so the caller data that node holds can be fetched without waiting.
+ *  @param List_Pos The position the cursor left.
+ *  @param List_Pos The position the cursor reached, may be none.
+ *  @param List_t* A pointer to the list walked.
+ *  @return void.
+ */
+static void List_Walk_Fetch(List_Pos behind_pos, List_Pos ahead_pos, List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_NODES == list_p->storage)
+	{
+		LIST_PREFETCH((void*)ahead_pos);
+	}
+	else if (LIST_STORAGE_INDEX == list_p->storage && LIST_POS_NONE != ahead_pos)
+	{
+		LIST_PREFETCH(LIST_SLOT(list_p, LIST_SLOT_OF_POS(ahead_pos)));
+	}
+	if (0 == list_p->elem_size)
+	{
+		LIST_PREFETCH(List_Pos_Data(behind_pos, list_p));
+	}
+}
+
+/*
+ *  @brief Start a walk over a run of positions, sending the cursor ahead out to the list's prefetch distance.
+ *  @param List_Walk* The walk to start.
+ *  @param List_t* A pointer to the list to walk, its lock must be held.
+ *  @param List_Pos The first position of the run, may be none.
+ *  @param size_t The number of positions in the run, the walk itself may be stepped past them but the cursor ahead is not.
+ *  @return List_Pos The first position of the run.
+ */
+static List_Pos List_Walk_Begin(List_Walk* walk_p, List_t* list_p, List_Pos first_pos, size_t count) //N/A
+{
+	walk_p->list_p = list_p;
+	walk_p->pos = first_pos;
+	walk_p->ahead_pos = first_pos;
+	walk_p->ahead_left = 0;
+	//the elements of a sized ring are one array, which the hardware fetches ahead on its own
+	if (0 == list_p->prefetch_distance || LIST_POS_NONE == first_pos || 0 == count
+		|| (LIST_STORAGE_RING == list_p->storage && 0 != list_p->elem_size))
+	{
+		return first_pos;
+	}
+	walk_p->ahead_left = count - 1;
+	for (size_t i = 0; i < list_p->prefetch_distance && 0 != walk_p->ahead_left; i++)
+	{
+		List_Pos behind_pos = walk_p->ahead_pos;
+		walk_p->ahead_pos = List_Pos_Next(behind_pos, list_p);
+		walk_p->ahead_left--;
+		List_Walk_Fetch(behind_pos, walk_p->ahead_pos, list_p);
+	}
+	return first_pos;
+}
+
+/*
+ *  @brief Step a walk to its next position, stepping the cursor ahead along with it.
+ *  @param List_Walk* The walk to step.
+ *  @return List_Pos The next position or LIST_POS_NONE at the end of the list.
+ */
+static List_Pos List_Walk_Next(List_Walk* walk_p) //N/A
+{
+	if (0 != walk_p->ahead_left && LIST_POS_NONE != walk_p->ahead_pos)
+	{
+		List_Pos behind_pos = walk_p->ahead_pos;
+		walk_p->ahead_pos = List_Pos_Next(behind_pos, walk_p->list_p);
+		walk_p->ahead_left--;
+		List_Walk_Fetch(behind_pos, walk_p->ahead_pos, walk_p->list_p);
+	}
+	walk_p->pos = List_Pos_Next(walk_p->pos, walk_p->list_p);
+	return walk_p->pos;
+}
+
+/*
+ *  @brief Insert data at a given index of an index storage list.
+ *  @param void* The data to insert, copied in for sized lists.
+ *  @param size_t The index the data should occupy.
+ *  @param List_t* A pointer to the list to insert into, its lock must be held.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Index_Insert(void* data_p, size_t at, List_t* list_p) //N/A
+{
+	if (at > list_p->length)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	//make sure this wouldnt exceed length limits
+	if (list_p->max_length && list_p->length >= list_p->max_length)
+	{
+		return LIST_ERROR_EXCEED_LIMIT;
+	}
+	List_Error_t ret_val = List_Index_Reserve(1, list_p);
+	if (LIST_ERROR_SUCCESS != ret_val)
+	{
+		return ret_val;
+	}
+	uint32_t slot = List_Index_Slot_Alloc(list_p);
+	List_Pos_Store(LIST_POS_OF_SLOT(slot), data_p, list_p);
+	List_Index_Link_Range(slot, slot, 1, at, list_p);
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Insert data at a given index of a ring storage list.
+ *  @param void* The data to insert, copied in for sized lists.
+ *  @param size_t The index the data should occupy.
+ *  @param List_t* A pointer to the list to insert into, its lock must be held.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Ring_Insert(void* data_p, size_t at, List_t* list_p) //N/A
+{
+	if (at > list_p->length)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	//make sure this wouldnt exceed length limits
+	if (list_p->max_length && list_p->length >= list_p->max_length)
+	{
+		return LIST_ERROR_EXCEED_LIMIT;
+	}
+	//heaps decide where everything goes themselves, new elements start out as the last leaf
+	if (list_p->heap)
+	{
+		at = list_p->length;
+	}
+	List_Error_t ret_val = List_Ring_Open(at, 1, list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		List_Pos_Store(LIST_POS_OF_RING(at), data_p, list_p);
+		if (list_p->heap)
+		{
+			List_Heap_Sift_Up(at, list_p);
+		}
+	}
+	return ret_val;
+}
+
+/*
+ *  @brief Put a fresh node in place of a pool node of a list, handing the pool node back to the pool.
+ *  @param List_Node* The pool node, linked into the list.
+ *  @param List_Node* The fresh node, which may come from any pool or block for a list of the same element size.
+ *  @param List_t* A pointer to the list, its lock must be held.
+ *  @return void.
+ */
+static void List_Node_Swap(List_Node* pool_node, List_Node* fresh_node, List_t* list_p) //N/A
+{
+	List_Pos_Store((List_Pos)fresh_node, pool_node->data_p, list_p);
+	//take the pool node's place
+	fresh_node->previous_p = pool_node->previous_p;
+	fresh_node->next_p = pool_node->next_p;
+	if (NULL != fresh_node->previous_p)
+	{
+		fresh_node->previous_p->next_p = fresh_node;
+	}
+	else
+	{
+		list_p->head_p = fresh_node;
+	}
+	if (NULL != fresh_node->next_p)
+	{
+		fresh_node->next_p->previous_p = fresh_node;
+	}
+	else
+	{
+		list_p->tail_p = fresh_node;
+	}
+	List_Node_Destroy(pool_node, list_p);
+}
+
+/*
+ *  @brief Swap every pool node a list is using for a heap node, in place.
+ *	   Pool nodes can never leave the list they were carved from, so this runs before a hidden list takes the nodes over.
+ *  @param List_t* A pointer to the list to unpool, its lock must be held.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *	   The list is untouched if the heap nodes cant be allocated.
+ */
+static List_Error_t List_Node_Unpool(List_t* list_p) //N/A
+{
+	if (0 == list_p->pool_used)
+	{
+		return LIST_ERROR_SUCCESS;
+	}
+	List_Node* fresh_node = List_Node_Block_Create(list_p->pool_used, list_p);
+	if (NULL == fresh_node)
+	{
+		return LIST_ERROR_FAILURE;
+	}
+	for (size_t i = 0; i < list_p->pool_count && NULL != fresh_node; i++)
+	{
+		List_Node* pool_node = (List_Node*)(list_p->pool_p + i * list_p->node_size);
+		//unused pool nodes never hold data
+		if (NULL == pool_node->data_p)
+		{
+			continue;
+		}
+		List_Node* next_fresh = fresh_node->next_p;
+		List_Node_Swap(pool_node, fresh_node, list_p);
+		fresh_node = next_fresh;
+	}
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Swap the pool nodes in a run of a list's nodes for nodes another list can keep, before the run moves there.
+ *	   Replacements come from the other list's pool while it has room, so moves between small lists allocate nothing,
+ *	   and the rest from a single block. Only the run is walked, and only until every pool node in use was seen.
+ *  @param List_t* A pointer to the list the run belongs to, its lock must be held. It must not be a buffer list.
+ *  @param List_Node* The first node of the run.
+ *  @param size_t The number of nodes in the run.
+ *  @param List_t* A pointer to the list the run is moving to, its lock must be held.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *	   The list is untouched if the nodes cant be allocated.
+ */
+static List_Error_t List_Node_Unpool_Range(List_t* list_p, List_Node* first_p, size_t count, List_t* to_p) //N/A
+{
+	//a list's own pool never holds more than this many nodes
+	List_Node* pooled_pp[LIST_POOL_BYTES / LIST_NODE_HEADER_SIZE];
+	size_t pooled = 0;
+	List_Node* node_p = first_p;
+	for (size_t i = 0; i < count && pooled < list_p->pool_used && NULL != node_p; i++)
+	{
+		if (List_Node_Is_Pooled(node_p, list_p))
+		{
+			pooled_pp[pooled++] = node_p;
+		}
+		node_p = node_p->next_p;
+	}
+	size_t from_pool = to_p->pool_count - to_p->pool_used;
+	if (from_pool > pooled)
+	{
+		from_pool = pooled;
+	}
+	List_Node* fresh_node = NULL;
+	if (pooled > from_pool && NULL == (fresh_node = List_Node_Block_Create(pooled - from_pool, list_p)))
+	{
+		return LIST_ERROR_FAILURE;
+	}
+	for (size_t i = 0; i < pooled; i++)
+	{
+		List_Node* next_fresh = NULL;
+		List_Node* swap_node = fresh_node;
+		if (i < from_pool)
+		{
+			swap_node = List_Node_Pool_Take(to_p);
+		}
+		else
+		{
+			next_fresh = fresh_node->next_p;
+		}
+		List_Node_Swap(pooled_pp[i], swap_node, list_p);
+		if (i >= from_pool)
+		{
+			fresh_node = next_fresh;
+		}
+	}
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Check whether nodes can be relinked from one list into another rather than copied over.
+ *	   Every node of a buffer list is carved from its buffer, so its elements are copied out rather than leave with them.
+ *  @param List_t* The list nodes would move into.
+ *  @param List_t* The list nodes would move out of.
+ *  @return bool True if both lists are made of nodes, the destination may hold nodes it didnt carve itself
+ *	   and the source isnt a buffer list.
+ */
+static bool List_Can_Relink(List_t* to_p, List_t* from_p) //N/A
+{
+	return LIST_STORAGE_NODES == to_p->storage && LIST_STORAGE_NODES == from_p->storage && !to_p->in_buffer && !from_p->in_buffer;
+}
+
+/*
+ *  @brief Check a list for sortedness. 
+ *  @param List_t* A pointer to the list to check for sortedness.
+			A list is considered sorted when each node's precedence is ordered from high to low
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use during sorting.
+						If NULL is used here, the list's default cmp function will be used
+ *  @return bool True if sorted fully, false otherwise
+ */
+static bool List_Is_Sorted(List_t* list_p, List_Cmp_Fnc cmp_fnc) //N/A
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	if (NULL == cmp_fnc)
+	{
+		cmp_fnc = list_p->cmp;
+	}
+	//get the first position, an empty list will give none
+	List_Pos current_pos = List_Pos_First(list_p);
+	//loop till we are at the second to last
+	for (size_t i = 0; i + 1 < list_p->length && LIST_POS_NONE != current_pos; i++)
+	{
+		List_Pos next_pos = List_Pos_Next(current_pos, list_p);
+		//compare current and next element
+		int node_cmp = 0;
+		if (NULL != cmp_fnc)
+		{
+			node_cmp = cmp_fnc(
+				List_Pos_Data(current_pos, list_p),
+				List_Pos_Data(next_pos, list_p)
+			);
+		}
+		if (0 > node_cmp)
+		{
+			return false;
+		}
+
+		current_pos = next_pos;
+	}
+	return true;
+}
+
+/*
+ *  @brief Reverse the order a list is laid out in, leaving which way it reads alone.
+ *  @param List_t* A pointer to the list to flip, its lock must be held and it must not share its storage.
+ *  @return void.
+ */
+static void List_Flip(List_t* list_p) //N/A
+{
+	//flip every slot's links in place, data never moves between slots
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		uint32_t slot = list_p->head_slot;
+		while (LIST_INDEX_NONE != slot)
+		{
+			List_Index_Links* links_p = LIST_SLOT_LINKS(list_p, slot);
+			uint32_t next_slot = links_p->next;
+			links_p->next = links_p->previous;
+			links_p->previous = next_slot;
+			slot = next_slot;
+		}
+		uint32_t old_head_slot = list_p->head_slot;
+		list_p->head_slot = list_p->tail_slot;
+		list_p->tail_slot = old_head_slot;
+		return;
+	}
+	//there are no links to flip, swap the elements themselves
+	//heaps are left alone, their order is theirs to keep
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		if (!list_p->heap)
+		{
+			List_Ring_Reverse(0, list_p->length, list_p);
+		}
+		return;
+	}
+
+	//flip every node's links in place, data never moves between nodes
+	List_Node* current_node = list_p->head_p;
+	while (NULL != current_node)
+	{
+		List_Node* next_node = current_node->next_p;
+		current_node->next_p = current_node->previous_p;
+		current_node->previous_p = next_node;
+		current_node = next_node;
+	}
+	List_Node* old_head_p = list_p->head_p;
+	list_p->head_p = list_p->tail_p;
+	list_p->tail_p = old_head_p;
+}
+
+/*
+ *  @brief Lay a reversed list out in the order it reads, for operations that work on the list as it is laid out.
+ *  @param List_t* A pointer to the list in question, its lock must be held and it must not share its storage.
+ *  @return void.
+ */
+static void List_Unreverse(List_t* list_p) //N/A
+{
+	if (list_p->reversed)
+	{
+		List_Flip(list_p);
+		list_p->reversed = false;
+	}
+}
+
+/*
+ *  @brief An element gathered up for sorting.
+ *	   Its data is kept next to its position so comparisons never have to chase links.
+ */
+typedef struct List_Sort_Entry
+{
+	void* data_p;
+	List_Pos pos;
+}
+List_Sort_Entry;
+
+/*
+ *  @brief Stable merge sort an array of entries by their data, highest precedence first.
+ *  @param List_Sort_Entry* The entries to sort in place.
+ *  @param List_Sort_Entry* Scratch space for at least as many entries.
+ *  @param size_t The number of entries.
+ *  @param List_Cmp_Fnc The function describing precedence, must not be NULL.
+ *  @return void.
+ */
+static void List_Merge_Sort(List_Sort_Entry* entries_p, List_Sort_Entry* scratch_p, size_t count, List_Cmp_Fnc cmp_fnc) //N/A
+{
+	//bottom up, ping-ponging between the two arrays
+	List_Sort_Entry* from_p = entries_p;
+	List_Sort_Entry* to_p = scratch_p;
+	for (size_t width = 1; width < count; width *= 2)
+	{
+		for (size_t left = 0; left < count; left += 2 * width)
+		{
+			size_t mid = (left + width < count) ? left + width : count;
+			size_t right = (mid + width < count) ? mid + width : count;
+			size_t i = left;
+			size_t j = mid;
+			size_t k = left;
+			while (i < mid && j < right)
+			{
+				//only take from the right when it truly has precedence, keeping equal entries in order
+				if (0 > cmp_fnc(from_p[i].data_p, from_p[j].data_p))
+				{
+					to_p[k++] = from_p[j++];
+				}
+				else
+				{
+					to_p[k++] = from_p[i++];
+				}
+			}
+			while (i < mid)
+			{
+				to_p[k++] = from_p[i++];
+			}
+			while (j < right)
+			{
+				to_p[k++] = from_p[j++];
+			}
+		}
+		List_Sort_Entry* tmp_p = from_p;
+		from_p = to_p;
+		to_p = tmp_p;
+	}
+	//make sure the result ends up where the caller expects it
+	if (from_p != entries_p)
+	{
+		memcpy(entries_p, from_p, count * sizeof(List_Sort_Entry));
+	}
+}
+
+/*
+ *  @brief Gather the data and position of every element of a list into an array of entries, in list order.
+ *  @param List_Sort_Entry* Room for at least as many entries.
+ *  @param size_t The most entries to gather.
+ *  @param List_t* The list to gather from.
+ *  @return size_t The number of entries gathered.
+ */
+static size_t List_Sort_Gather(List_Sort_Entry* entries_p, size_t count, List_t* list_p) //N/A
+{
+	size_t gathered = 0;
+	List_Walk walk;
+	List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), count);
+	while (gathered < count && LIST_POS_NONE != current_pos)
+	{
+		entries_p[gathered].data_p = List_Pos_Data(current_pos, list_p);
+		entries_p[gathered].pos = current_pos;
+		current_pos = List_Walk_Next(&walk);
+		gathered++;
+	}
+	return gathered;
+}
+
+/*
+ *  @brief Relink every element of a list in the order given by an array of entries.
+ *	   Ring storage lists have nothing to relink, so their elements are written back in that order instead.
+ *	   The list is laid out in that order afterwards, so a reversed list no longer is.
+ *  @param List_Sort_Entry* Every element of the list, in the order they should be linked.
+ *  @param size_t The number of entries, which must be the length of the list.
+ *  @param List_t* The list the entries belong to.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *	   Only sized ring storage lists need memory to reorder, and are left untouched without it.
+ */
+static List_Error_t List_Relink(List_Sort_Entry* entries_p, size_t count, List_t* list_p) //N/A
+{
+	if (0 == count)
+	{
+		return LIST_ERROR_SUCCESS;
+	}
+	//ring storage has no links, the elements themselves have to be put in order
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		if (0 == list_p->elem_size)
+		{
+			for (size_t i = 0; i < count; i++)
+			{
+				*(void**)List_Ring_Slot(i, list_p) = entries_p[i].data_p;
+			}
+			list_p->reversed = false;
+			return LIST_ERROR_SUCCESS;
+		}
+		//inline elements are pointed at from the entries, so they are gathered elsewhere first
+		unsigned char* sorted_p = malloc(count * list_p->node_size);
+		if (NULL == sorted_p)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		for (size_t i = 0; i < count; i++)
+		{
+			memcpy(sorted_p + i * list_p->node_size, entries_p[i].data_p, list_p->node_size);
+		}
+		memcpy(list_p->slots_p, sorted_p, count * list_p->node_size);
+		list_p->ring_head = 0;
+		list_p->reversed = false;
+		free(sorted_p);
+		return LIST_ERROR_SUCCESS;
+	}
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			List_Index_Links* links_p = LIST_SLOT_LINKS(list_p, LIST_SLOT_OF_POS(entries_p[i].pos));
+			links_p->previous = (0 < i) ? LIST_SLOT_OF_POS(entries_p[i - 1].pos) : LIST_INDEX_NONE;
+			links_p->next = (i + 1 < count) ? LIST_SLOT_OF_POS(entries_p[i + 1].pos) : LIST_INDEX_NONE;
+		}
+		list_p->head_slot = LIST_SLOT_OF_POS(entries_p[0].pos);
+		list_p->tail_slot = LIST_SLOT_OF_POS(entries_p[count - 1].pos);
+		list_p->reversed = false;
+		return LIST_ERROR_SUCCESS;
+	}
+	for (size_t i = 0; i < count; i++)
+	{
+		List_Node* node_p = (List_Node*)(entries_p[i].pos);
+		node_p->previous_p = (0 < i) ? (List_Node*)(entries_p[i - 1].pos) : NULL;
+		node_p->next_p = (i + 1 < count) ? (List_Node*)(entries_p[i + 1].pos) : NULL;
+	}
+	list_p->head_p = (List_Node*)(entries_p[0].pos);
+	list_p->tail_p = (List_Node*)(entries_p[count - 1].pos);
+	list_p->reversed = false;
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Move every node of a list into a single new block laid out in list order.
+ *  @param List_t* A pointer to the list to compact, its lock must be held.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *	   The list is untouched if the new block cant be allocated.
+ */
+static List_Error_t List_Compact_Locked(List_t* list_p) //N/A
+{
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		return List_Index_Compact(list_p);
+	}
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		return List_Ring_Resize(list_p->length, list_p);
+	}
+	//buffer lists already keep every node in one array
+	if (list_p->in_buffer)
+	{
+		return LIST_ERROR_SUCCESS;
+	}
+	size_t count = list_p->length;
+	if (0 != count)
+	{
+		List_Node* new_node = List_Node_Block_Create(count, list_p);
+		if (NULL == new_node)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		//move the data over, releasing old nodes as we go
+		List_Node* current_node = list_p->head_p;
+		list_p->head_p = new_node;
+		for (size_t i = 0; i < count && NULL != current_node; i++)
+		{
+			List_Node* next_node = current_node->next_p;
+			if (0 != list_p->elem_size)
+			{
+				memcpy(new_node->data_p, current_node->data_p, list_p->elem_size);
+			}
+			else
+			{
+				new_node->data_p = current_node->data_p;
+			}
+			List_Node_Destroy(current_node, list_p);
+			current_node = next_node;
+			list_p->tail_p = new_node;
+			new_node = new_node->next_p;
+		}
+	}
+	list_p->churn = 0;
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Compact a list if it has seen enough churn since its last compaction.
+ *  @param List_t* A pointer to the list to check, its lock must be held.
+ *  @return void. A failed compaction is simply tried again on a later check.
+ */
+static void List_Compact_Check(List_t* list_p) //N/A
+{
+	if (0 == list_p->compact_threshold || LIST_COMPACT_MIN_LENGTH > list_p->length)
+	{
+		return;
+	}
+	//nothing else moves the elements of sized node lists, so pointers to them are kept good until asked otherwise
+	if (LIST_STORAGE_NODES == list_p->storage && 0 != list_p->elem_size)
+	{
+		return;
+	}
+	//threshold percent of the length, split up to keep it from overflowing
+	size_t limit = (list_p->length / 100) * list_p->compact_threshold
+		+ ((list_p->length % 100) * list_p->compact_threshold) / 100;
+	if (list_p->churn >= limit)
+	{
+		List_Compact_Locked(list_p);
+	}
+}
+
+/*
+ *  @brief Set up an empty list in storage that has already been found for it.
+ *  @param List_t* A pointer to the uninitialized list.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list, may be NULL.
+ *  @param List_Free_Fnc A function used when freeing data within the list, unused for sized lists.
+ *  @param size_t The number of bytes to store inline per element or 0 to hold caller pointers.
+ *  @param List_Storage How the elements should be kept in memory.
+ *  @param unsigned char* Storage for the list's first nodes, aligned for a node, or NULL for none.
+ *  @param size_t The number of nodes that fit in that storage.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Setup(List_t* list_p, size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free_fnc, size_t elem_size,
+	List_Storage storage, unsigned char* pool_p, size_t pool_count) //N/A
+{
+	list_p->length = 0;
+	list_p->max_length = max_length;
+	list_p->head_p = NULL;
+	list_p->tail_p = NULL;
+	list_p->cmp = cmp;
+	list_p->free = free_fnc;
+	list_p->elem_size = elem_size;
+	list_p->node_size = LIST_NODE_HEADER_SIZE + LIST_ALIGN_UP(elem_size);
+	list_p->churn = 0;
+	list_p->compact_threshold = 0;
+	list_p->prefetch_distance = LIST_PREFETCH_DEFAULT;
+
+	list_p->storage = storage;
+	list_p->slots_p = NULL;
+	list_p->links_offset = 0;
+	list_p->slot_capacity = 0;
+	list_p->slot_count = 0;
+	list_p->head_slot = LIST_INDEX_NONE;
+	list_p->tail_slot = LIST_INDEX_NONE;
+	list_p->free_slot = LIST_INDEX_NONE;
+	list_p->ring_head = 0;
+	//carve the pool into nodes, keeping them in address order
+	list_p->pool_p = pool_p;
+	list_p->pool_free_p = NULL;
+	list_p->pool_count = (LIST_STORAGE_NODES == storage) ? pool_count : 0;
+	list_p->pool_used = 0;
+	list_p->in_buffer = false;
+	list_p->heap = false;
+	list_p->reversed = false;
+	list_p->writes = 0;
+	list_p->share_p = NULL;
+	atomic_init(&(list_p->shares), 0);
+	for (size_t i = list_p->pool_count; i > 0; i--)
+	{
+		List_Node* node_p = (List_Node*)(pool_p + (i - 1) * list_p->node_size);
+		node_p->data_p = NULL;
+		node_p->next_p = list_p->pool_free_p;
+		node_p->previous_p = NULL;
+		node_p->block_p = NULL;
+		list_p->pool_free_p = node_p;
+	}
+	if (LIST_STORAGE_INDEX == storage)
+	{
+		//a slot only needs the alignment of its element, which divides its size, and of its links
+		size_t payload = (0 != elem_size) ? elem_size : sizeof(void*);
+		size_t align = payload & (~payload + 1);
+		if (align > _Alignof(max_align_t))
+		{
+			align = _Alignof(max_align_t);
+		}
+		if (align < _Alignof(List_Index_Links))
+		{
+			align = _Alignof(List_Index_Links);
+		}
+		list_p->links_offset = (payload + _Alignof(List_Index_Links) - 1) / _Alignof(List_Index_Links) * _Alignof(List_Index_Links);
+		list_p->node_size = (list_p->links_offset + sizeof(List_Index_Links) + align - 1) / align * align;
+	}
+	else if (LIST_STORAGE_RING == storage)
+	{
+		//slots are just the elements, packed like an array of them
+		list_p->node_size = (0 != elem_size) ? elem_size : sizeof(void*);
+	}
+
+	if (0 != pthread_mutex_init(&(list_p->lock), NULL))
+	{
+		return LIST_ERROR_FAILURE;
+	}
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Allocate and set up an empty list, along with room for its first few nodes right after it.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list, may be NULL.
+ *  @param List_Free_Fnc A function used when freeing data within the list, unused for sized lists.
+ *  @param size_t The number of bytes to store inline per element or 0 to hold caller pointers.
+ *  @param List_Storage How the elements should be kept in memory.
+ *  @param bool Whether a node storage list gets a pool, lists that never insert have no use for one.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+static List_t* List_Alloc_Pooled(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free_fnc, size_t elem_size, List_Storage storage,
+	bool pooled) //N/A
+{
+	if (elem_size > SIZE_MAX - 2 * LIST_NODE_HEADER_SIZE)
+	{
+		return NULL;
+	}
+	//only node storage takes nodes from a pool, and big elements may leave no room for any
+	size_t node_size = LIST_NODE_HEADER_SIZE + LIST_ALIGN_UP(elem_size);
+	size_t pool_count = (pooled && LIST_STORAGE_NODES == storage) ? LIST_POOL_BYTES / node_size : 0;
+	List_t* new_list_p = malloc(LIST_ALIGN_UP(sizeof(List_t)) + pool_count * node_size);
+	if (NULL != new_list_p)
+	{
+		if (LIST_ERROR_SUCCESS != List_Setup(new_list_p, max_length, cmp, free_fnc, elem_size, storage,
+			(unsigned char*)new_list_p + LIST_ALIGN_UP(sizeof(List_t)), pool_count))
+		{
+			free(new_list_p);
+			new_list_p = NULL;
+		}
+	}
+	return new_list_p;
+}
+
+/*
+ *  @brief Allocate and set up an empty list, with a pool if it uses node storage.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list, may be NULL.
+ *  @param List_Free_Fnc A function used when freeing data within the list, unused for sized lists.
+ *  @param size_t The number of bytes to store inline per element or 0 to hold caller pointers.
+ *  @param List_Storage How the elements should be kept in memory.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+static List_t* List_Alloc(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free_fnc, size_t elem_size, List_Storage storage) //N/A
+{
+	return List_Alloc_Pooled(max_length, cmp, free_fnc, elem_size, storage, true);
+}
+
+/*
+ *  @brief Create an empty list configured just like another one.
+ *  @param List_t* A pointer to the list whose settings should be used.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+static List_t* List_Create_Like(List_t* list_p) //N/A
+{
+	List_t* new_list_p = List_Alloc(list_p->max_length, list_p->cmp, list_p->free, list_p->elem_size, list_p->storage);
+	if (NULL != new_list_p)
+	{
+		new_list_p->heap = list_p->heap;
+	}
+	return new_list_p;
+}
+
+/*
+ *  @brief Create an empty list.
+ *  @param size_t The maximum size to allow the list to grow.
+					If 0 is passed as this value, no maximum will be enforced (Not recommended!)
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free) //N/A
+{
+	if (NULL == free)
+	{
+		return NULL;
+	}
+	return List_Alloc(max_length, cmp, free, 0, LIST_STORAGE_NODES);
+}
+
+/*
+ *  @brief Create an empty list that stores fixed size elements inline in its nodes.
+ *	   Inserting copies the element in, accessors hand back pointers to the copy held by the node.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp) //N/A
+{
+	if (0 == elem_size)
+	{
+		return NULL;
+	}
+	return List_Alloc(max_length, cmp, NULL, elem_size, LIST_STORAGE_NODES);
+}
+
+/*
+ *  @brief Create an empty list that keeps its elements in one growable array linked by 32 bit indices.
+ *	   Each element costs 16 bytes on 64 bit targets instead of a separately allocated node.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum other than the 2^32 - 1 slots indices can name.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Compact(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free) //N/A
+{
+	if (NULL == free)
+	{
+		return NULL;
+	}
+	return List_Alloc(max_length, cmp, free, 0, LIST_STORAGE_INDEX);
+}
+
+/*
+ *  @brief Create an empty list that keeps fixed size elements inline in one growable array linked by 32 bit indices.
+ *	   Each element costs its own size plus 8 bytes of links, rounded up to the element's alignment.
+ *	   Pointers to elements are only good until the array next has to grow or the list is compacted.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum other than the 2^32 - 1 slots indices can name.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Compact_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp) //N/A
+{
+	if (0 == elem_size)
+	{
+		return NULL;
+	}
+	return List_Alloc(max_length, cmp, NULL, elem_size, LIST_STORAGE_INDEX);
+}
+
+/*
+ *  @brief Create an empty list that keeps its elements in one growable circular array, in list order.
+ *	   Pushing or removing at either end and indexing are all O(1), inserting or removing elsewhere
+ *	   moves the elements on the shorter side of the index.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum. The array never grows past it.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Deque(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free) //N/A
+{
+	if (NULL == free)
+	{
+		return NULL;
+	}
+	return List_Alloc(max_length, cmp, free, 0, LIST_STORAGE_RING);
+}
+
+/*
+ *  @brief Create an empty list that keeps fixed size elements inline in one growable circular array, in list order.
+ *	   Pointers to elements are only good until the list is next changed.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum. The array never grows past it.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Deque_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp) //N/A
+{
+	if (0 == elem_size)
+	{
+		return NULL;
+	}
+	return List_Alloc(max_length, cmp, NULL, elem_size, LIST_STORAGE_RING);
+}
+
+/*
+ *  @brief Create an empty priority queue, a list kept as a binary heap so that its first element always has the most precedence.
+ *	   Inserting and removing are O(log n) and the indices given to them are only checked, never honored.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list, required.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Heap(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free) //N/A
+{
+	if (NULL == cmp || NULL == free)
+	{
+		return NULL;
+	}
+	List_t* new_list_p = List_Alloc(max_length, cmp, free, 0, LIST_STORAGE_RING);
+	if (NULL != new_list_p)
+	{
+		new_list_p->heap = true;
+	}
+	return new_list_p;
+}
+
+/*
+ *  @brief Create an empty priority queue of fixed size elements stored inline.
+ *	   Pointers to elements are only good until the list is next changed.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list, required.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Heap_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp) //N/A
+{
+	if (0 == elem_size || NULL == cmp)
+	{
+		return NULL;
+	}
+	List_t* new_list_p = List_Alloc(max_length, cmp, NULL, elem_size, LIST_STORAGE_RING);
+	if (NULL != new_list_p)
+	{
+		new_list_p->heap = true;
+	}
+	return new_list_p;
+}
+
+/*
+ *  @brief Get the number of bytes a buffer needs to hold a list made with List_Init_In_Buffer.
+ *  @param size_t The number of elements the list should be able to hold.
+ *  @return size_t The size in bytes, which allows for a buffer of any alignment, or 0 if it cant be represented.
+ */
+size_t List_Buffer_Size(size_t max_length) //N/A
+{
+	size_t header = LIST_ALIGN_UP(sizeof(List_t)) + _Alignof(max_align_t) - 1;
+	if (0 == max_length || max_length > (SIZE_MAX - header) / LIST_NODE_HEADER_SIZE)
+	{
+		return 0;
+	}
+	return header + max_length * LIST_NODE_HEADER_SIZE;
+}
+
+/*
+ *  @brief Set up an empty list inside a caller provided buffer, along with a node for every element it may hold.
+ *	   Nothing is ever allocated for the list afterwards: inserts take nodes from a free list kept in the buffer
+ *	   and fail with LIST_ERROR_EXCEED_LIMIT once max_length is reached.
+ *  @param void* The buffer to put the list in, which must outlive the list.
+ *  @param size_t The size of the buffer in bytes, at least List_Buffer_Size(max_length).
+ *  @param size_t The number of elements the list can hold, must be at least 1.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the list, somewhere within the buffer, or NULL on error.
+ *	   List_Destroy releases the elements but leaves the buffer to the caller.
+ */
+List_t* List_Init_In_Buffer(void* buf_p, size_t bytes, size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free) //N/A
+{
+	size_t needed = List_Buffer_Size(max_length);
+	if (NULL == buf_p || NULL == free || 0 == needed || bytes < needed)
+	{
+		return NULL;
+	}
+	//the list and its nodes need the alignment malloc would have given them
+	uintptr_t start = ((uintptr_t)buf_p + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t);
+	List_t* new_list_p = (List_t*)start;
+	unsigned char* nodes_p = (unsigned char*)start + LIST_ALIGN_UP(sizeof(List_t));
+	if (LIST_ERROR_SUCCESS != List_Setup(new_list_p, max_length, cmp, free, 0, LIST_STORAGE_NODES, nodes_p, max_length))
+	{
+		return NULL;
+	}
+	new_list_p->in_buffer = true;
+	return new_list_p;
+}
+
+/*
+ *  @brief The share of a copy handed to a single thread.
+ */
+typedef struct List_Copy_Job
+{
+	List_t* list_p; //list the positions belong to
+	List_Pos first_pos; //first position whose data should be copied in place
+	size_t count; //number of positions to copy
+	List_Copy_Fnc copy_node_fnc;
+	bool failed; //set if the copy function ever gave back NULL
+}
+List_Copy_Job;
+
+/*
+ *  @brief Replace the data of a run of positions with copies made by the job's copy function.
+ *	   On failure every position after the failed one is cleared so that only copies are left behind.
+ *  @param void* A pointer to the List_Copy_Job to run.
+ *  @return void* NULL, the result is reported through the job.
+ */
+static void* List_Copy_Job_Run(void* job_vp) //N/A
+{
+	List_Copy_Job* job_p = job_vp;
+	//the walk stays within this job's positions, other threads are storing into the rest
+	List_Walk walk;
+	List_Pos current_pos = List_Walk_Begin(&walk, job_p->list_p, job_p->first_pos, job_p->count);
+	for (size_t i = 0; i < job_p->count && LIST_POS_NONE != current_pos; i++)
+	{
+		void* copy_p = NULL;
+		if (!job_p->failed)
+		{
+			copy_p = job_p->copy_node_fnc(List_Pos_Data(current_pos, job_p->list_p));
+			job_p->failed = (NULL == copy_p);
+		}
+		List_Pos_Store(current_pos, copy_p, job_p->list_p);
+		current_pos = List_Walk_Next(&walk);
+	}
+	return NULL;
+}
+
+/*
+ *  @brief Run a copy function over the data of a run of positions, replacing each value with its copy.
+ *  @param List_t* A pointer to the list the positions belong to, which must hold caller pointers.
+ *  @param List_Pos The first position of the run, which may belong to a chain not yet linked into the list.
+ *  @param size_t The number of positions.
+ *  @param List_Copy_Fnc The function used to copy each value.
+ *  @param size_t The number of threads to use including the caller, 0 picks one per online cpu.
+ *  @return bool True if every copy succeeded. On failure only copies are left behind, anything else is NULL.
+ */
+static bool List_Copy_Data(List_t* list_p, List_Pos first_pos, size_t count, List_Copy_Fnc copy_node_fnc, size_t thread_count) //N/A
+{
+	if (0 == thread_count)
+	{
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		thread_count = (0 < cpus) ? (size_t)cpus : 1;
+	}
+	if (thread_count > count)
+	{
+		thread_count = count;
+	}
+
+	List_Copy_Job* jobs_p = NULL;
+	pthread_t* threads_p = NULL;
+	bool* started_p = NULL;
+	if (1 < thread_count)
+	{
+		jobs_p = calloc(thread_count, sizeof(List_Copy_Job));
+		threads_p = calloc(thread_count, sizeof(pthread_t));
+		started_p = calloc(thread_count, sizeof(bool));
+	}
+	if (NULL == jobs_p || NULL == threads_p || NULL == started_p)
+	{
+		//one thread (or no memory to track more), just do it all here
+		free(jobs_p);
+		free(threads_p);
+		free(started_p);
+		List_Copy_Job job = { list_p, first_pos, count, copy_node_fnc, false };
+		List_Copy_Job_Run(&job);
+		return !job.failed;
+	}
+
+	//split the positions as evenly as possible, this thread takes the first share
+	size_t share = count / thread_count;
+	size_t extra = count % thread_count;
+	List_Pos current_pos = first_pos;
+	for (size_t t = 0; t < thread_count; t++)
+	{
+		jobs_p[t].list_p = list_p;
+		jobs_p[t].first_pos = current_pos;
+		jobs_p[t].count = share + ((t < extra) ? 1 : 0);
+		jobs_p[t].copy_node_fnc = copy_node_fnc;
+		jobs_p[t].failed = false;
+		//walk to where the next share starts
+		for (size_t i = 0; i < jobs_p[t].count && LIST_POS_NONE != current_pos; i++)
+		{
+			current_pos = List_Pos_Next(current_pos, list_p);
+		}
+	}
+	for (size_t t = 1; t < thread_count; t++)
+	{
+		started_p[t] = (0 == pthread_create(&(threads_p[t]), NULL, List_Copy_Job_Run, &(jobs_p[t])));
+	}
+	List_Copy_Job_Run(&(jobs_p[0]));
+
+	bool copied = true;
+	for (size_t t = 0; t < thread_count; t++)
+	{
+		if (started_p[t])
+		{
+			pthread_join(threads_p[t], NULL);
+		}
+		else if (0 != t)
+		{
+			//couldnt get a thread for this share, do it here
+			List_Copy_Job_Run(&(jobs_p[t]));
+		}
+		copied = copied && !jobs_p[t].failed;
+	}
+
+	free(jobs_p);
+	free(threads_p);
+	free(started_p);
+	return copied;
+}
+
+/*
+ *  @brief Empty a copy whose data could not all be copied, freeing the copies that were made.
+ *  @param List_t* The copy, whose positions are not linked in yet for node storage. It is left empty but still valid.
+ *  @param List_Pos The first position of the copied run.
+ *  @param size_t The number of positions in the run, each holding a copy or NULL.
+ *  @return void.
+ */
+static void List_Copy_Discard(List_t* copy_list, List_Pos first_pos, size_t count) //N/A
+{
+	List_Pos copy_pos = first_pos;
+	for (size_t i = 0; i < count && LIST_POS_NONE != copy_pos; i++)
+	{
+		List_Pos next_pos = List_Pos_Next(copy_pos, copy_list);
+		void* copy_data_p = List_Pos_Data(copy_pos, copy_list);
+		if (NULL != copy_data_p)
+		{
+			copy_list->free(copy_data_p);
+		}
+		if (LIST_STORAGE_NODES == copy_list->storage)
+		{
+			List_Node_Destroy((List_Node*)copy_pos, copy_list);
+		}
+		copy_pos = next_pos;
+	}
+	if (LIST_STORAGE_NODES != copy_list->storage)
+	{
+		List_Index_Release(copy_list);
+	}
+}
+
+/*
+ *  @brief Copy the elements of a list whose lock is already held into an empty list configured just like it.
+ *	   Every node is allocated in a single block and linked in one pass over the source,
+ *	   index storage lists copy their slot array as is.
+ *  @param List_t* The list to copy.
+ *  @param List_t* The empty list to copy into, which must not be reversed. It is left empty on error.
+ *  @param List_Copy_Fnc A user provided function to copy node values or NULL for a shallow copy.
+ *  @param size_t The number of threads to spread calls to the copy function over, 0 picks one per online cpu.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Copy_Storage(List_t* list_p, List_t* copy_list, List_Copy_Fnc copy_node_fnc, size_t thread_count) //N/A
+{
+	if (0 == list_p->length)
+	{
+		return LIST_ERROR_SUCCESS;
+	}
+
+	size_t count = list_p->length;
+	List_Node* first_p = NULL;
+	List_Node* last_p = NULL;
+	List_Pos first_pos = LIST_POS_NONE;
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		//slots keep their numbers, so the links and free slots carry over untouched
+		copy_list->slots_p = malloc(list_p->slot_count * list_p->node_size);
+		if (NULL == copy_list->slots_p)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		memcpy(copy_list->slots_p, list_p->slots_p, list_p->slot_count * list_p->node_size);
+		copy_list->slot_capacity = list_p->slot_count;
+		copy_list->slot_count = list_p->slot_count;
+		copy_list->head_slot = list_p->head_slot;
+		copy_list->tail_slot = list_p->tail_slot;
+		copy_list->free_slot = list_p->free_slot;
+		copy_list->length = count;
+		first_pos = List_Pos_First(copy_list);
+	}
+	else if (LIST_STORAGE_RING == list_p->storage)
+	{
+		//the copy starts out unwrapped and exactly full
+		copy_list->slots_p = malloc(count * list_p->node_size);
+		if (NULL == copy_list->slots_p)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		List_Ring_Flatten(copy_list->slots_p, list_p);
+		copy_list->slot_capacity = count;
+		copy_list->length = count;
+		first_pos = List_Pos_First(copy_list);
+	}
+	else
+	{
+		first_p = List_Node_Chain_Create(count, copy_list);
+		if (NULL == first_p)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		//gather the source data in order, inline elements are simply copied over
+		List_Walk walk;
+		List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), count);
+		List_Node* copy_node = first_p;
+		last_p = first_p;
+		for (size_t i = 0; i < count && LIST_POS_NONE != current_pos; i++)
+		{
+			List_Pos_Store((List_Pos)copy_node, List_Pos_Data(current_pos, list_p), copy_list);
+			last_p = copy_node;
+			current_pos = List_Walk_Next(&walk);
+			copy_node = copy_node->next_p;
+		}
+		first_pos = (List_Pos)first_p;
+	}
+
+	if (0 == list_p->elem_size && NULL != copy_node_fnc && !List_Copy_Data(copy_list, first_pos, count, copy_node_fnc, thread_count))
+	{
+		List_Copy_Discard(copy_list, first_pos, count);
+		return LIST_ERROR_FAILURE;
+	}
+
+	if (LIST_STORAGE_NODES == copy_list->storage)
+	{
+		List_Node_Link_Range(first_p, last_p, count, 0, copy_list);
+	}
+	//slots are copied as they are laid out, nodes in the order the list reads
+	copy_list->reversed = (LIST_STORAGE_NODES != list_p->storage) && list_p->reversed;
+	//copies may not compare the way their originals did
+	if (copy_list->heap && NULL != copy_node_fnc)
+	{
+		List_Heap_Build(copy_list);
+	}
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Copy a list whose lock is already held.
+ *  @param List_t* The list to copy.
+ *  @param List_Copy_Fnc A user provided function to copy node values or NULL for a shallow copy.
+ *  @param size_t The number of threads to spread calls to the copy function over, 0 picks one per online cpu.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+static List_t* List_Copy_Locked(List_t* list_p, List_Copy_Fnc copy_node_fnc, size_t thread_count) //N/A
+{
+	List_t* copy_list = List_Create_Like(list_p);
+	if (NULL != copy_list && LIST_ERROR_SUCCESS != List_Copy_Storage(list_p, copy_list, copy_node_fnc, thread_count))
+	{
+		List_Destroy(copy_list);
+		copy_list = NULL;
+	}
+	return copy_list;
+}
+
+/*
+ *  @brief Point a list at the storage of another one, without copying or taking ownership of anything.
+ *  @param List_t* The list to point.
+ *  @param List_t* The list whose storage it should see, configured just like it.
+ *  @return void.
+ */
+static void List_Share_Mirror(List_t* list_p, List_t* from_p) //N/A
+{
+	list_p->length = from_p->length;
+	list_p->head_p = from_p->head_p;
+	list_p->tail_p = from_p->tail_p;
+	list_p->slots_p = from_p->slots_p;
+	list_p->slot_capacity = from_p->slot_capacity;
+	list_p->slot_count = from_p->slot_count;
+	list_p->head_slot = from_p->head_slot;
+	list_p->tail_slot = from_p->tail_slot;
+	list_p->free_slot = from_p->free_slot;
+	list_p->ring_head = from_p->ring_head;
+}
+
+/*
+ *  @brief Leave a list empty without freeing its storage, which someone else owns.
+ *  @param List_t* The list to empty.
+ *  @return void.
+ */
+static void List_Share_Forget(List_t* list_p) //N/A
+{
+	list_p->head_p = NULL;
+	list_p->tail_p = NULL;
+	list_p->slots_p = NULL;
+	List_Index_Release(list_p);
+}
+
+/*
+ *  @brief Let go of a share of a hidden list's storage, the last one to let go destroying it and the storage with it.
+ *	   A hidden list never frees values, so they are left to the list they were cloned from.
+ *  @param List_t* The hidden list.
+ *  @return void.
+ */
+static void List_Share_Release(List_t* share_p) //N/A
+{
+	if (1 == atomic_fetch_sub(&(share_p->shares), 1))
+	{
+		List_Destroy(share_p);
+	}
+}
+
+/*
+ *  @brief Take a share of a list's storage, handing the storage over to a hidden list if nothing shares it yet.
+ *	   The storage cant change while the share is held, so it can be read without the list's lock.
+ *  @param List_t* The list whose storage to share, its lock must be held. It must not live in a caller buffer.
+ *  @return List_t* The hidden list owning the storage, to be let go of with List_Share_Release, or NULL on error.
+ */
+static List_t* List_Share_Acquire(List_t* list_p) //N/A
+{
+	//unpooling moves nodes, and a list sharing its storage has to copy it before it writes again
+	list_p->writes++;
+	if (NULL == list_p->share_p)
+	{
+		//the hidden list cant own nodes from this list's pool, and never inserts so it needs none of its own
+		//the values stay this list's to free, however many lists end up holding them
+		List_t* share_p = List_Alloc_Pooled(list_p->max_length, list_p->cmp, NULL, list_p->elem_size, list_p->storage, false);
+		if (NULL == share_p || LIST_ERROR_SUCCESS != List_Node_Unpool(list_p))
+		{
+			List_Destroy(share_p);
+			return NULL;
+		}
+		share_p->heap = list_p->heap;
+		List_Share_Mirror(share_p, list_p);
+		atomic_store(&(share_p->shares), 1);
+		list_p->share_p = share_p;
+	}
+	atomic_fetch_add(&(list_p->share_p->shares), 1);
+	return list_p->share_p;
+}
+
+/*
+ *  @brief Give a list storage of its own before anything writes to it.
+ *	   If it is the last list sharing its storage it just takes it over, otherwise the storage is copied.
+ *	   Which values a list frees doesnt change, a clone never frees any whether it copies or takes the storage over.
+ *  @param List_t* The list about to be written to, its lock must be held.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur, in which case the list still shares.
+ */
+static List_Error_t List_Unshare(List_t* list_p) //N/A
+{
+	//every write goes through here first
+	list_p->writes++;
+	List_t* share_p = list_p->share_p;
+	if (NULL == share_p)
+	{
+		return LIST_ERROR_SUCCESS;
+	}
+	if (1 == atomic_load(&(share_p->shares)))
+	{
+		//nobody else can see the storage, and this list already mirrors it
+		List_Share_Forget(share_p);
+	}
+	else
+	{
+		//the copy is laid out just like the storage, which way the list reads is its own
+		bool reversed = list_p->reversed;
+		list_p->reversed = false;
+		List_Share_Forget(list_p);
+		List_Error_t ret_val = List_Copy_Storage(share_p, list_p, NULL, 1);
+		list_p->reversed = reversed;
+		if (LIST_ERROR_SUCCESS != ret_val)
+		{
+			List_Share_Mirror(list_p, share_p);
+			return LIST_ERROR_FAILURE;
+		}
+	}
+	list_p->share_p = NULL;
+	List_Share_Release(share_p);
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Copy that the given list is valid.
+ *  @param List_t* The list to copy.
+ *  @param List_Copy_Fnc A user provided function to copy node values.
+			If Null is passed, a shallow copy will be formed where:
+				Each node value is the same pointer
+				The list itself will be in different
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Copy(List_t* list_p, List_Copy_Fnc copy_node_fnc) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+	List_t* copy_list = List_Copy_Locked(list_p, copy_node_fnc, 1);
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return copy_list;
+}
+
+/*
+ *  @brief Copy a list, spreading calls to the copy function over several threads.
+ *	   Meant for expensive deep copies, the copy function must be safe to call from multiple threads.
+ *  @param List_t* The list to copy.
+ *  @param List_Copy_Fnc A user provided function to copy node values.
+			If Null is passed, a shallow copy will be formed just like List_Copy.
+ *  @param size_t The number of threads to use including the caller, 0 picks one per online cpu.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Copy_Parallel(List_t* list_p, List_Copy_Fnc copy_node_fnc, size_t thread_count) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+	List_t* copy_list = List_Copy_Locked(list_p, copy_node_fnc, thread_count);
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return copy_list;
+}
+
+/*
+ *  @brief Map a list whose lock is already held into a new list of caller pointers.
+ *	   Every node of the new list is allocated in a single block and handed the source data in one pass,
+ *	   then List_Copy_Data replaces each with its mapped value.
+ *  @param List_t* The list to map.
+ *  @param List_Copy_Fnc The function giving each mapped value.
+ *  @param List_Free_Fnc The function the new list frees its values with.
+ *  @param size_t The number of threads to spread calls to the map function over, 0 picks one per online cpu.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+static List_t* List_Map_Locked(List_t* list_p, List_Copy_Fnc map_fnc, List_Free_Fnc free_fnc, size_t thread_count) //N/A
+{
+	List_t* map_list = List_Alloc(list_p->max_length, NULL, free_fnc, 0, LIST_STORAGE_NODES);
+	size_t count = list_p->length;
+	if (NULL == map_list || 0 == count)
+	{
+		return map_list;
+	}
+
+	List_Node* first_p = List_Node_Chain_Create(count, map_list);
+	if (NULL == first_p)
+	{
+		List_Destroy(map_list);
+		return NULL;
+	}
+	List_Walk walk;
+	List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), count);
+	List_Node* map_node = first_p;
+	List_Node* last_p = first_p;
+	for (size_t i = 0; i < count && LIST_POS_NONE != current_pos; i++)
+	{
+		map_node->data_p = List_Pos_Data(current_pos, list_p);
+		last_p = map_node;
+		current_pos = List_Walk_Next(&walk);
+		map_node = map_node->next_p;
+	}
+
+	if (!List_Copy_Data(map_list, (List_Pos)first_p, count, map_fnc, thread_count))
+	{
+		List_Copy_Discard(map_list, (List_Pos)first_p, count);
+		List_Destroy(map_list);
+		return NULL;
+	}
+	List_Node_Link_Range(first_p, last_p, count, 0, map_list);
+	return map_list;
+}
+
+/*
+ *  @brief Map every value of a list into a new list of the same length, in the same order.
+ *  @param List_t* The list to map, which may hold caller pointers or inline elements.
+ *  @param List_Copy_Fnc The function giving the new value for each one. If it ever gives back NULL the whole map fails.
+ *  @param List_Free_Fnc The function the new list frees its values with.
+ *  @return List_t* A pointer to the allocated list of caller pointers or NULL on error.
+ */
+List_t* List_Map(List_t* list_p, List_Copy_Fnc map_fnc, List_Free_Fnc free_fnc) //safe
+{
+	return List_Map_Parallel(list_p, map_fnc, free_fnc, 1);
+}
+
+/*
+ *  @brief Map every value of a list into a new list, spreading calls to the map function over several threads.
+ *	   Meant for expensive mappings, the map function must be safe to call from multiple threads.
+ *  @param List_t* The list to map, which may hold caller pointers or inline elements.
+ *  @param List_Copy_Fnc The function giving the new value for each one. If it ever gives back NULL the whole map fails.
+ *  @param List_Free_Fnc The function the new list frees its values with.
+ *  @param size_t The number of threads to use including the caller, 0 picks one per online cpu.
+ *  @return List_t* A pointer to the allocated list of caller pointers or NULL on error.
+ */
+List_t* List_Map_Parallel(List_t* list_p, List_Copy_Fnc map_fnc, List_Free_Fnc free_fnc, size_t thread_count) //safe
+{
+	//check params
+	if (NULL == list_p || NULL == map_fnc || NULL == free_fnc)
+	{
+		return NULL;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+	List_t* map_list = List_Map_Locked(list_p, map_fnc, free_fnc, thread_count);
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return map_list;
+}
+
+/*
+ *  @brief Clone a list that cant share its storage by copying it, the copy holding the list's caller pointers without freeing them.
+ *  @param List_t* The list to clone, its lock must be held.
+ *  @return List_t* A pointer to the copy or NULL on error.
+ */
+static List_t* List_Clone_Eager(List_t* list_p) //N/A
+{
+	List_t* copy_list = List_Create_Like(list_p);
+	if (NULL == copy_list)
+	{
+		return NULL;
+	}
+	copy_list->free = NULL;
+	if (LIST_ERROR_SUCCESS != List_Copy_Storage(list_p, copy_list, NULL, 1))
+	{
+		List_Destroy(copy_list);
+		return NULL;
+	}
+	return copy_list;
+}
+
+/*
+ *  @brief Clone a list in O(1), the clone sharing the list's storage until either of them writes to it.
+ *	   The first clone hands the storage over to a hidden list that the list and every clone of it read from.
+ *	   Whichever list writes first copies the whole storage for itself, the last one left takes it over as is.
+ *  @param List_t* The list to clone.
+ *  @return List_t* A pointer to the clone, holding the same caller pointers as List_Copy with no copy function would,
+ *	   or NULL on error.
+ */
+List_t* List_Clone_COW(List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//buffer lists cant give their storage away and empty lists have nothing to share
+	if (list_p->in_buffer || (NULL == list_p->share_p && 0 == list_p->length))
+	{
+		List_t* copy_list = List_Clone_Eager(list_p);
+		pthread_mutex_unlock(&(list_p->lock));
+		return copy_list;
+	}
+	List_t* clone_list = List_Create_Like(list_p);
+	List_t* share_p = (NULL != clone_list) ? List_Share_Acquire(list_p) : NULL;
+	if (NULL == share_p)
+	{
+		List_Destroy(clone_list);
+		clone_list = NULL;
+	}
+	else
+	{
+		//only the list cloned from frees the values
+		clone_list->free = NULL;
+		List_Share_Mirror(clone_list, share_p);
+		clone_list->reversed = list_p->reversed;
+		clone_list->share_p = share_p;
+	}
+
+	pthread_mutex_unlock(&(list_p->lock));
+	return clone_list;
+}
+
+/*
+ *  @brief Give a list storage of its own, copying whatever it still shares with copy on write clones.
+ *  @param List_t* The list to give its own storage.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur, in which case the list still shares.
+ */
+List_Error_t List_Own_Storage(List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+	List_Error_t ret_val = List_Unshare(list_p);
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Verify that the given list is valid.
+ *  @param List_t* The list to verify.
+ *  @param List_Find_Fnc A user provided function to cehck validity of list values.
+			If Null is passed, this will not be used and only metadata will be validated.
+ *  @return List_Error_t LIST_ERROR_SUCCESS if the list is valid or an error attempting to describe the failure.
+ */
+List_Error_t List_Verify(List_t* list_p, List_Find_Fnc valid_check) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+	
+	//walk every position, an empty list has none
+	List_Walk walk;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+		LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk))
+	{
+		//user validity check
+		if (NULL != valid_check && !valid_check(List_Pos_Data(current_pos, list_p)))
+		{
+			ret_val = LIST_ERROR_BAD_ENTRY;
+			goto exit;
+		}
+	}
+
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Get the data in the node at the given location.
+ *  @param size_t The index of the node in question.
+ *  @param List_t* The list that contains the node in question.
+ *  @return void* The data held within the node at the given location or NULL on error.
+ */
+void* List_At(size_t at, List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	void* ret_val = NULL;
+
+	pthread_mutex_lock(&(list_p->lock));
+	List_Pos at_pos = List_Pos_At(at, list_p);
+	if (LIST_POS_NONE != at_pos)
+	{
+		ret_val = List_Pos_Data(at_pos, list_p);
+	}
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return ret_val;
+}
+
+/*
+ *  @brief Put data into the end of a given list.
+ *  @param void* The data to insert to the end of the list.
+ *  @param List_t* The list that should contain the given node.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Push(void* data_p, List_t* list_p) //safe
+{
+	//check param
+	if (NULL == list_p || NULL == data_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	return List_Insert(data_p, list_p->length, list_p); //safe call
+}
+
+/*
+ *  @brief Put data into the beginning of a given list.
+ *  @param void* The data to insert to the end of the list.
+ *  @param List_t* The list that should contain the given node.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Unshift(void* data_p, List_t* list_p) //safe
+{
+	//check param
+	if (NULL == list_p || NULL == data_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	return List_Insert(data_p, 0, list_p); //safe call
+}
+
+/*
+ *  @brief Put data into the given index of a given list.
+ *  @param void* The data to insert to the list.
+ *  @param size_t The index in which to insert the given data to.
+ *  @param List_t* The list that should contain the given node.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Insert(void* data_p, size_t at, List_t* list_p) //safe
+{
+	//check param
+	if (NULL == list_p || NULL == data_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+
+	//slots live in the list's own array, so they can only be handed out under the lock
+	if (LIST_STORAGE_NODES != list_p->storage)
+	{
+		pthread_mutex_lock(&(list_p->lock));
+		List_Error_t ret_val = List_Unshare(list_p);
+		if (LIST_ERROR_SUCCESS == ret_val)
+		{
+			at = List_Laid_Out_Insert_At(at, list_p);
+			ret_val = (LIST_STORAGE_RING == list_p->storage)
+				? List_Ring_Insert(data_p, at, list_p) : List_Index_Insert(data_p, at, list_p);
+		}
+		List_Compact_Check(list_p);
+		pthread_mutex_unlock(&(list_p->lock));
+		return ret_val;
+	}
+
+	//small lists take their nodes from their pool, which needs the lock
+	pthread_mutex_lock(&(list_p->lock));
+	List_Node* new_node_p = List_Node_Pool_Take(list_p);
+	if (NULL != new_node_p)
+	{
+		List_Pos_Store((List_Pos)new_node_p, data_p, list_p);
+	}
+	else if (list_p->in_buffer)
+	{
+		//every node of a buffer list is in its pool, so it is full
+		pthread_mutex_unlock(&(list_p->lock));
+		return LIST_ERROR_EXCEED_LIMIT;
+	}
+	else
+	{
+		//otherwise try to allocate the node outside the lock
+		pthread_mutex_unlock(&(list_p->lock));
+		new_node_p = List_Node_Create(data_p, list_p);
+		//make sure it was allocated properly
+		if (NULL == new_node_p)
+		{
+			return LIST_ERROR_BAD_ENTRY;
+		}
+		pthread_mutex_lock(&(list_p->lock));
+	}
+
+	//at is checked in insert node
+	List_Error_t ret_val = List_Unshare(list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		ret_val = List_Node_Insert(new_node_p, List_Laid_Out_Insert_At(at, list_p), list_p);
+	}
+	//the node never made it into the list
+	if (LIST_ERROR_SUCCESS != ret_val)
+	{
+		List_Node_Destroy(new_node_p, list_p);
+	}
+	List_Compact_Check(list_p);
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return ret_val;
+}
+
+/*
+ *  @brief Find the first instance of a given search data using the defined compare function.
+ *  @param void* The data to use as a 'search term'.
+ *  @param List_t* The list that should contain the given search term.
+ 		The function uses the list's cmp function to decide if a node is "equal" to the search term.
+		 If the cmp function is not defined, the function will assume that all nodes are the same,
+		 	therefore returning the first node it 'sees'.
+ *  @param size_t* A pointer in which to put the index if any should be found.
+	   Note that this will not be changed if no match is found.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on successful find, LIST_ERROR_EXCEED_LIMIT if not found in list,
+ 						or any error that may occur.
+ */
+List_Error_t List_Find(void* search_data_p, List_t* list_p, size_t* response) //safe
+{
+	//check params
+	if (NULL == list_p || NULL == search_data_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//walk every position, an empty list has none
+	List_Walk walk;
+	size_t i = 0;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+		LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk), i++)
+	{
+		//check if this node is the right one
+		int nodes_match = 0;
+		//null cmp function should result in 0
+		if (NULL != list_p->cmp)
+		{
+			nodes_match = list_p->cmp(search_data_p, List_Pos_Data(current_pos, list_p));
+		}
+		if (0 == nodes_match)
+		{
+			if (NULL != response)
+			{
+				*response = i;
+			}
+			//return success code
+			goto exit;
+		}
+	}
+
+	//return success code
+	ret_val = LIST_ERROR_EXCEED_LIMIT;
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Test each node in a list using a given find function until an entry passes or no entries are left.
+ *  @param List_t* The list to test entries within.
+ *  @param List_Find_Fnc The function to test each entry using.
+	   A test is passed when this function returns true after being given data.
+ *  @return bool True if an entry is found that passes the given test or false if no nodes pass or an error occurs.
+ */
+bool List_Some(List_t* list_p, List_Find_Fnc do_fnc) //safe
+{
+	//check params
+	if (NULL == list_p || NULL == do_fnc)
+	{
+		return false;
+	}
+	bool ret_val = false;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//walk every position, an empty list has none
+	List_Walk walk;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+		LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk))
+	{
+		//check if this node is the right one
+		bool node_found = do_fnc(List_Pos_Data(current_pos, list_p));
+		if (node_found)
+		{
+			ret_val = true;
+			goto exit;
+		}
+	}
+
+	//we didnt find a match
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Test each node in a list using a given find function until an entry fails or no entries are left.
+ *  @param List_t* The list to test entries within.
+ *  @param List_Find_Fnc The function to test each entry using.
+	   A test is passed when this function returns true after being given data and failed if false is returned.
+ *  @return bool True if all entries pass th egiven test or false when one fails or an error occurs.
+ */
+bool List_Every(List_t* list_p, List_Find_Fnc do_fnc) //safe
+{
+	//check params
+	if (NULL == list_p || NULL == do_fnc)
+	{
+		return false;
+	}
+	bool ret_val = true;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//walk every position, an empty list has none
+	List_Walk walk;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+		LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk))
+	{
+		//check if this node fails
+		bool node_failed = do_fnc(List_Pos_Data(current_pos, list_p));
+		if (!node_failed)
+		{
+			ret_val = false;
+			goto exit;
+		}
+	}
+
+	//we didnt find a failure!
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Run a given function against all data entries within a list.
+ *  @param List_t* The list to test entries within.
+ *  @param List_Do_Fnc The function to run with each entry.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_For_Each(List_t* list_p, List_Do_Fnc do_fnc) //safe
+{
+	//check params
+	if (NULL == list_p || NULL == do_fnc)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//inline elements are written in place, caller pointers are the caller's own
+	if (0 != list_p->elem_size)
+	{
+		ret_val = List_Unshare(list_p);
+	}
+	//walk every position, an empty list has none
+	List_Walk walk;
+	List_Pos first_pos = (LIST_ERROR_SUCCESS == ret_val) ? List_Pos_First(list_p) : LIST_POS_NONE;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, first_pos, list_p->length);
+		LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk))
+	{
+		do_fnc(List_Pos_Data(current_pos, list_p));
+	}
+
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Remove a given index from the list.
+ *  @param size_t The index to remove from the list.
+ *  @param List_t* The list to remove the given index from.
+ *  @return void* The data held within the removed node or NULL on error.
+ */
+void* List_Remove_At(size_t at, List_t* list_p) //safe
+{
+	//check params, inline elements would go away with their node so sized lists need List_Remove_At_Into
+	if (NULL == list_p || at > list_p->length || 0 != list_p->elem_size)
+	{
+		return NULL;
+	}
+	void* ret_val = NULL;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//find the node
+	List_Pos pos = (LIST_ERROR_SUCCESS == List_Unshare(list_p)) ? List_Pos_At(at, list_p) : LIST_POS_NONE;
+	if (LIST_POS_NONE == pos)
+	{
+		ret_val = NULL;
+		goto exit;
+	}
+	//save the nodes data
+	void* node_data = List_Pos_Data(pos, list_p);
+	//remove the node
+	List_Error_t removed_node = List_Pos_Remove(pos, list_p);
+	if (LIST_ERROR_SUCCESS != removed_node)
+	{
+		ret_val = NULL;
+		goto exit;
+	}
+	ret_val = node_data;
+	List_Compact_Check(list_p);
+
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	//return data
+	return ret_val;
+}
+
+/*
+ *  @brief Remove a given index from the list and destroy the data held within it.
+ *  @param size_t The index to delete from the list.
+ *  @param List_t* The list to delete the given index from.
+ *  @return void.
+ */
+void List_Delete_At(size_t at, List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p || at > list_p->length)
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//find the node and delete it
+	List_Pos pos = (LIST_ERROR_SUCCESS == List_Unshare(list_p)) ? List_Pos_At(at, list_p) : LIST_POS_NONE;
+	if (LIST_POS_NONE != pos)
+	{
+		List_Pos_Delete(pos, list_p);
+		List_Compact_Check(list_p);
+	}
+
+	pthread_mutex_unlock(&(list_p->lock));
+}
+
+/*
+ *  @brief Remove the last node from the list.
+ *  @param List_t* The list to remove the last node from.
+ *  @return void* The data held within the removed node or NULL on error.
+ */
+void* List_Pop(List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	//get the head node, an empty list will give NULL
+	void* removing_node_data = List_Remove_At(list_p->length-1, list_p); //safe call
+
+	//we should be on the correct node data, return it
+	return removing_node_data;
+}
+
+/*
+ *  @brief Remove the first node from the list.
+ *  @param List_t* The list to remove the first node from.
+ *  @return void* The data held within the removed node or NULL on error.
+ */
+void* List_Shift(List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	//get the head node, an empty list will give NULL
+	void* removing_node_data = List_Remove_At(0, list_p); //safe call
+
+	//we should be on the correct node data, return it
+	return removing_node_data;
+}
+
+/*
+ *  @brief 					- Create an iterator for in-order procession through items in the given list.
+ *  @param List_p 			- A pointer to the list to create an iterator for.
+ *  @return List_Iterator_p - A pointer to an allocated list iterator or NULL on failure.
+ */
+List_Iterator_p List_Iterator_Create(List_p list_p)
+{
+	List_Iterator_p iter_p = NULL;
+	if (NULL != list_p)
+	{
+		iter_p = calloc(1, sizeof(List_Iterator_t));
+		if (NULL != iter_p)
+		{
+			iter_p->list_p = list_p;
+			iter_p->curr_pos = LIST_POS_NONE;
+			iter_p->flags = 0;
+		}
+	}
+	return iter_p;
+}
+/*
+ *  @brief 					- Create a iterator for reversed-order procession through items in the given list.
+ *  @param List_p 			- A pointer to the list to create a iterator for.
+ *  @return List_Iterator_p - A pointer to an allocated list iterator or NULL on failure.
+ */
+List_Iterator_p List_Iterator_Create_Reverse(List_p list_p) //safe
+{
+	List_Iterator_p iter_p = NULL;
+	if (NULL != list_p)
+	{
+		iter_p = calloc(1, sizeof(List_Iterator_t));
+		if (NULL != iter_p)
+		{
+			iter_p->list_p = list_p;
+			iter_p->curr_pos = LIST_POS_NONE;
+			iter_p->flags = LIST_ITER_FLAG_REVERSE;
+		}
+	}
+	return iter_p;
+}
+/*
+ *  @brief 					- Set up an iterator in caller storage, which needs no allocation and no List_Iterator_Destroy.
+ *  @param List_Iterator_Storage* - The storage to use, which must outlive the iterator.
+ *  @param List_p 			- A pointer to the list to iterate over.
+ *  @param bool 			- True for reversed-order procession, false for in-order.
+ *  @return List_Iterator_p - The storage as an iterator or NULL on failure.
+ */
+List_Iterator_p List_Iterator_Init(List_Iterator_Storage* storage_p, List_p list_p, bool reverse) //safe
+{
+	if (NULL == storage_p || NULL == list_p)
+	{
+		return NULL;
+	}
+	List_Iterator_p iter_p = (List_Iterator_p)storage_p;
+	iter_p->list_p = list_p;
+	iter_p->curr_pos = LIST_POS_NONE;
+	iter_p->flags = LIST_ITER_FLAG_EMBEDDED | (reverse ? LIST_ITER_FLAG_REVERSE : 0);
+	return iter_p;
+}
+/*
+ *  @brief 					- Copy an iterator to a newly allocated iterator.
+ *  @param List_Iterator_p	- A pointer to the iterator to copy.
+ *  @return List_Iterator_p - A pointer to a copied list iterator or NULL on failure.
+ */
+List_Iterator_p List_Iterator_Copy(List_Iterator_p iter_p)
+{
+	if (NULL != iter_p)
+	{
+		List_Iterator_p new_iter_p = calloc(1, sizeof(List_Iterator_t));
+		if (NULL != new_iter_p)
+		{
+			memcpy(new_iter_p, iter_p, sizeof(List_Iterator_t));
+			new_iter_p->flags &= (uint8_t)~LIST_ITER_FLAG_EMBEDDED;
+		}
+		return new_iter_p;
+	}
+	return NULL;
+}
+/*
+ *  @brief 					- Proceed to the next item in the list using the given iterator.
+ *  @param List_Iterator_p	- A pointer to the iterator who is to proceed to its next list item.
+ *  @return List_Iterator_p - A pointer to the data held by the iterator after proceeding to the next item its order or NULL on failure.
+ * 								- Although expected, the end of an iteration is considered an 'error' and thus returns NULL when hit.
+ */
+void* List_Iterator_Next(List_Iterator_p iter_p) 
+{
+	void* ret_data = NULL;
+	if (NULL != iter_p && NULL != iter_p->list_p)
+	{
+
+		pthread_mutex_lock(&(iter_p->list_p->lock));
+
+		if (LIST_POS_NONE != iter_p->curr_pos)
+		{
+			iter_p->curr_pos = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? List_Pos_Prev(iter_p->curr_pos, iter_p->list_p) : List_Pos_Next(iter_p->curr_pos, iter_p->list_p);
+		}
+		//if this is the first call to next, start the iteration
+		else if (!(iter_p->flags & LIST_ITER_FLAG_FINISHED))
+		{
+			iter_p->curr_pos = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? List_Pos_Last(iter_p->list_p) : List_Pos_First(iter_p->list_p);
+		}
+
+		//now that we have updated curr_pos, set the return value if possible
+		if (LIST_POS_NONE != iter_p->curr_pos)
+		{
+			ret_data = List_Pos_Data(iter_p->curr_pos, iter_p->list_p);
+		}
+
+		//if we are returning NULL this must be the end of the list
+		if (NULL == ret_data)
+		{
+			iter_p->flags ^= LIST_ITER_FLAG_FINISHED;
+		}
+		pthread_mutex_unlock(&(iter_p->list_p->lock));
+	}
+	return ret_data;
+}
+/*
+ *  @brief 					- Preceed to the previous item in the list using the given iterator.
+ *  @param List_Iterator_p 	- A pointer to the iterator who is to preceed to its previous list item.
+ *  @return List_Iterator_p - A pointer to the data held by the iterator after preceeding to the previous item in its order.
+ * 								- Although expected, the end of an iteration is considered an 'error' and thus returns NULL when hit.
+ */
+void* List_Iterator_Prev(List_Iterator_p iter_p)
+{
+	void* ret_data = NULL;
+	if (NULL != iter_p && NULL != iter_p->list_p) //valid check
+	{ 
+
+		pthread_mutex_lock(&(iter_p->list_p->lock));
+
+		if (LIST_POS_NONE != iter_p->curr_pos)//normal scenario
+		{
+			iter_p->curr_pos = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? List_Pos_Next(iter_p->curr_pos, iter_p->list_p) : List_Pos_Prev(iter_p->curr_pos, iter_p->list_p);
+		}
+		//if finished
+		else if (iter_p->flags & LIST_ITER_FLAG_FINISHED)
+		{
+			iter_p->curr_pos = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? List_Pos_First(iter_p->list_p) : List_Pos_Last(iter_p->list_p);
+			iter_p->flags ^= LIST_ITER_FLAG_FINISHED;
+		}
+
+		//now that we have updated curr_pos, set the return value if possible
+		if (LIST_POS_NONE != iter_p->curr_pos)
+		{
+			ret_data = List_Pos_Data(iter_p->curr_pos, iter_p->list_p);
+		}
+		pthread_mutex_unlock(&(iter_p->list_p->lock));
+	}
+	return ret_data;
+}
+/*
+ *  @brief 					- Get a pointer to the data currently held by the iterator.
+ *  @param List_Iterator_p 	- A pointer to the iterator whose list item is to be requested.
+ *  @return List_Iterator_p - A pointer to the data held by the iterator after proceeding to the next item in the list or NULL on error.
+ * 								- If the iteration has never been started after creation, NULL will be returned.
+ * 								- Calling after the iteration finishes will 'step back' to the last item successfully seen
+ */
+void* List_Iterator_Curr(List_Iterator_p iter_p)
+{
+	if (NULL != iter_p && LIST_POS_NONE != iter_p->curr_pos)
+	{
+		return List_Pos_Data(iter_p->curr_pos, iter_p->list_p);
+	}
+	return NULL;
+}
+/*
+ *  @brief 					- Destroy an iterator.
+ *  @param List_Iterator_p 	- A pointer to the iterator to be destroyed.
+ *  @return void.
+ */
+void List_Iterator_Destroy(List_Iterator_p iter_p)
+{
+	//iterators in caller storage are the caller's to get rid of
+	if (NULL != iter_p && !(iter_p->flags & LIST_ITER_FLAG_EMBEDDED))
+	{
+		free(iter_p);
+	}
+}
+
+/*
+ *  @brief Remove the first node from the list.
+ *  @param List_t* The list to reduce.
+ *  @param list_reduce_fnc The function used to reduce each node.
+ *  @param void* The value to begin reduction with.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Reduce(List_t* list_p, List_Reduce_Fnc reducer, void* accumulator) //safe
+{
+	//check params
+	if (NULL == list_p || NULL == reducer || NULL == accumulator)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+	
+	//walk every position, an empty list has none
+	List_Walk walk;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+		LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk))
+	{
+		accumulator = reducer(List_Pos_Data(current_pos, list_p), accumulator);
+	}
+
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Test each node in a list using a given find function, removing each that fail the given find function.
+ *	   Note that filtered entries will be destroyed.
+ *  @param List_t* The list to filter entries from.
+ *  @param List_Find_Fnc The function to test each entry using.
+ *	   A test is passed when this function returns true after being given data.
+ *	   A test is failed and filtered out if false is returned.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Filter(List_t* list_p, List_Find_Fnc do_fnc) //safe
+{
+	//check params
+	if (NULL == list_p || NULL == do_fnc)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	if (LIST_ERROR_SUCCESS != (ret_val = List_Unshare(list_p)))
+	{
+		goto exit;
+	}
+	//removing from the middle of a ring shifts everything after it, so keepers are packed down in one pass instead
+	if (LIST_STORAGE_RING == list_p->storage)
+	{
+		List_Unreverse(list_p);
+		size_t kept = 0;
+		for (size_t i = 0; i < list_p->length; i++)
+		{
+			void* data_p = List_Pos_Data(LIST_POS_OF_RING(i), list_p);
+			if (do_fnc(data_p))
+			{
+				if (kept != i)
+				{
+					memcpy(List_Ring_Slot(kept, list_p), List_Ring_Slot(i, list_p), list_p->node_size);
+				}
+				kept++;
+			}
+			else
+			{
+				List_Value_Free(data_p, list_p);
+			}
+		}
+		list_p->length = kept;
+		if (list_p->heap)
+		{
+			List_Heap_Build(list_p);
+		}
+		goto exit;
+	}
+
+	//get the first position, an empty list will give none
+	List_Pos current_pos = List_Pos_First(list_p);
+	//loop till the end (have to use index here)
+	for (size_t i = 0; i < list_p->length && LIST_POS_NONE != current_pos; i++)
+	{
+		//make sure the node is valid
+		if (LIST_POS_NONE != current_pos)
+		{
+			//check if this node is the right one
+			bool do_result = do_fnc(List_Pos_Data(current_pos, list_p));
+			//store next node
+			List_Pos next_pos = List_Pos_Next(current_pos, list_p);
+			if (!do_result)
+			{
+				//delete node and free its data
+				List_Pos_Delete(current_pos, list_p);
+				i--;
+			}
+			//use next node
+			current_pos = next_pos;
+		}
+		else
+		{
+			//we have hit a dead end
+			ret_val = LIST_ERROR_BAD_ENTRY;
+			goto exit;
+		}
+	}
+	//we didnt find a match
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Remove and destroy every node in the given list.
+ *  @param List_t* The list to destroy nodes within.
+ *  @return void.
+ */
+void List_Purge(List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return;
+	}
+	pthread_mutex_lock(&(list_p->lock));
+	list_p->writes++;
+
+	//shared storage is left to the lists still sharing it, but the values are still this list's to free
+	if (NULL != list_p->share_p)
+	{
+		for (List_Pos current_pos = List_Pos_First(list_p); LIST_POS_NONE != current_pos; current_pos = List_Pos_Next(current_pos, list_p))
+		{
+			List_Value_Free(List_Pos_Data(current_pos, list_p), list_p);
+		}
+		List_Share_Forget(list_p);
+		List_Share_Release(list_p->share_p);
+		list_p->share_p = NULL;
+	}
+	//delete all list members until length is 0
+	while (0 != list_p->length)
+	{
+		List_Pos_Delete(List_Pos_First(list_p), list_p);
+	}
+	//an empty index or ring storage list has no use for its slots
+	if (LIST_STORAGE_NODES != list_p->storage)
+	{
+		List_Index_Release(list_p);
+	}
+	pthread_mutex_unlock(&(list_p->lock));
+	return;
+}
+
+/*
+ *  @brief Destroy the given list and every node within it.
+ *  @param List_t* The list to destroy.
+ *  @return void.
+ */
+void List_Destroy(List_t* list_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return;
+	}
+	List_Purge(list_p); //safe call
+	//all has been freed
+	pthread_mutex_destroy(&(list_p->lock));
+	//buffer lists belong to whoever gave the buffer
+	if (!list_p->in_buffer)
+	{
+		free(list_p);//setting to null here does nothing
+	}
+	return;
+}
+
+/*
+ *  @brief Get the current length of a given list.
+ *  @param List_t* The list in question.
+ *  @return size_t the length of the list
+ * 	   Not ethat 0 will be returned if the list does not exist.
+ */
+size_t List_Length(List_t* list_p) //safe
+{
+	if (NULL != list_p)
+	{
+		return list_p->length;
+	}
+	return 0;
+}
+
+/*
+ *  @brief Reverse a given list from its current order in O(1).
+ *	   Nothing is moved, the list just reads the other way from now on.
+ *  @param List_t* The list to reverse.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Reverse(List_t* list_p) //safe
+{
+	if (NULL == list_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+	//heaps are left alone, their order is theirs to keep
+	if (!list_p->heap)
+	{
+		list_p->reversed = !list_p->reversed;
+		list_p->writes++;
+	}
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Reverse a given list from its current order by relinking every node, or moving every element of a ring.
+ *  @param List_t* The list to reverse.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Reverse_In_Place(List_t* list_p) //safe
+{
+	if (NULL == list_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+	List_Error_t ret_val = List_Unshare(list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		List_Flip(list_p);
+	}
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return ret_val;
+}
+
+/*
+ *  @brief Sort a given list using the set comparison function.
+ *	   A list is considered sorted when precedence is in oredr from high to low
+ *  @param List_t* The list to sort.
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use during sorting.
+						If NULL is used here, the list's default cmp function will be used
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Sort(List_t* list_p, List_Cmp_Fnc cmp_fnc)
+{
+	if (NULL == list_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	if (NULL == cmp_fnc)
+	{
+		cmp_fnc = list_p->cmp;
+	}
+	//no cmp function means everything has the same precedence, which is already sorted
+	if (NULL == cmp_fnc || List_Is_Sorted(list_p, cmp_fnc) || LIST_ERROR_SUCCESS != (ret_val = List_Unshare(list_p)))
+	{
+		goto exit;
+	}
+
+	//sort the nodes themselves so inline elements never end up pointed at from another node
+	size_t count = list_p->length;
+	List_Sort_Entry stack_entries[2 * LIST_SORT_STACK_ENTRIES];
+	List_Sort_Entry* entries_p = (count <= LIST_SORT_STACK_ENTRIES) ? stack_entries : malloc(2 * count * sizeof(List_Sort_Entry));
+	if (NULL == entries_p)
+	{
+		ret_val = LIST_ERROR_FAILURE;
+		goto exit;
+	}
+	size_t gathered = 0;
+	List_Pos current_pos = List_Pos_First(list_p);
+	while (gathered < count && LIST_POS_NONE != current_pos)
+	{
+		entries_p[gathered].data_p = List_Pos_Data(current_pos, list_p);
+		entries_p[gathered].pos = current_pos;
+		current_pos = List_Pos_Next(current_pos, list_p);
+		gathered++;
+	}
+	List_Merge_Sort(entries_p, entries_p + count, gathered, cmp_fnc);
+	ret_val = List_Relink(entries_p, gathered, list_p);
+	//sorted by the list's own cmp a heap is still a heap, by anything else it has to be rebuilt
+	if (list_p->heap && cmp_fnc != list_p->cmp)
+	{
+		List_Heap_Build(list_p);
+	}
+	if (stack_entries != entries_p)
+	{
+		free(entries_p);
+	}
+
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Sort a given list like List_Sort, but without holding its lock while comparing.
+ *	   The positions and elements are snapshot under the lock and sorted without it, then the new order
+ *	   is linked in under the lock in O(n). If the list was written in the meantime the sort is thrown away
+ *	   and taken again, and after LIST_SORT_RETRIES attempts the list is sorted with List_Sort instead.
+ *	   Inline elements are copied into the snapshot, but caller pointers are compared where they are, so a value
+ *	   removed by another thread during the sort must not be freed until the sort returns.
+ *  @param List_t* The list to sort.
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use during sorting.
+						If NULL is used here, the list's default cmp function will be used
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Sort_Concurrent(List_t* list_p, List_Cmp_Fnc cmp_fnc) //safe
+{
+	if (NULL == list_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	for (size_t attempt = 0; attempt < LIST_SORT_RETRIES; attempt++)
+	{
+		pthread_mutex_lock(&(list_p->lock));
+		List_Cmp_Fnc sort_cmp = (NULL != cmp_fnc) ? cmp_fnc : list_p->cmp;
+		size_t count = list_p->length;
+		size_t elem_size = list_p->elem_size;
+		//short lists sort quicker than they are snapshot
+		if (NULL == sort_cmp || LIST_SORT_STACK_ENTRIES >= count)
+		{
+			pthread_mutex_unlock(&(list_p->lock));
+			break;
+		}
+		//the positions snapshot have to be this list's own, so shared storage is copied first
+		List_Sort_Entry* entries_p = NULL;
+		if (LIST_ERROR_SUCCESS != List_Unshare(list_p)
+			|| NULL == (entries_p = malloc(2 * count * sizeof(List_Sort_Entry) + count * elem_size)))
+		{
+			pthread_mutex_unlock(&(list_p->lock));
+			return LIST_ERROR_FAILURE;
+		}
+		size_t gathered = List_Sort_Gather(entries_p, count, list_p);
+		//inline elements can be written or freed once the lock is let go, so they are compared from a copy
+		unsigned char* elems_p = (unsigned char*)(entries_p + 2 * count);
+		for (size_t i = 0; 0 != elem_size && i < gathered; i++)
+		{
+			memcpy(elems_p + i * elem_size, entries_p[i].data_p, elem_size);
+			entries_p[i].data_p = elems_p + i * elem_size;
+		}
+		size_t writes = list_p->writes;
+		pthread_mutex_unlock(&(list_p->lock));
+
+		List_Merge_Sort(entries_p, entries_p + count, gathered, sort_cmp);
+
+		pthread_mutex_lock(&(list_p->lock));
+		//positions taken before any write are still where the snapshot found them
+		bool unchanged = (list_p->writes == writes);
+		if (unchanged && LIST_ERROR_SUCCESS == (ret_val = List_Unshare(list_p)))
+		{
+			for (size_t i = 0; 0 != elem_size && i < gathered; i++)
+			{
+				entries_p[i].data_p = List_Pos_Data(entries_p[i].pos, list_p);
+			}
+			ret_val = List_Relink(entries_p, gathered, list_p);
+			if (list_p->heap && sort_cmp != list_p->cmp)
+			{
+				List_Heap_Build(list_p);
+			}
+		}
+		pthread_mutex_unlock(&(list_p->lock));
+		free(entries_p);
+		if (unchanged)
+		{
+			return ret_val;
+		}
+	}
+	return List_Sort(list_p, cmp_fnc);
+}
+
+/*
+ *  @brief An element gathered up for sorting by an integer key, which is extracted once up front.
+ */
+typedef struct List_Key_Entry
+{
+	uint64_t key;
+	List_Sort_Entry entry;
+}
+List_Key_Entry;
+
+/*
+ *  @brief Stable LSD radix sort an array of entries by their keys, highest key first, a byte at a time.
+ *	   Every pass counts digits up front and any byte that is the same in every key is skipped.
+ *  @param List_Key_Entry* The entries to sort.
+ *  @param List_Key_Entry* Scratch space for at least as many entries.
+ *  @param size_t The number of entries.
+ *  @param size_t The number of low bytes of the keys to sort by, from 1 to 8.
+ *  @return List_Key_Entry* Whichever of the two arrays ended up holding the sorted entries.
+ */
+static List_Key_Entry* List_Radix_Sort(List_Key_Entry* entries_p, List_Key_Entry* scratch_p, size_t count, size_t key_width) //N/A
+{
+	//one pass over the keys gives the digit counts for every byte
+	size_t counts[sizeof(uint64_t)][256] = {{ 0 }};
+	for (size_t i = 0; i < count; i++)
+	{
+		uint64_t key = entries_p[i].key;
+		for (size_t byte = 0; byte < key_width; byte++)
+		{
+			counts[byte][(key >> (8 * byte)) & 0xFF]++;
+		}
+	}
+
+	List_Key_Entry* from_p = entries_p;
+	List_Key_Entry* to_p = scratch_p;
+	for (size_t byte = 0; byte < key_width; byte++)
+	{
+		size_t shift = 8 * byte;
+		if (count == counts[byte][(from_p[0].key >> shift) & 0xFF])
+		{
+			continue;
+		}
+		//high digits go first, and equal digits keep their order so earlier passes still count
+		size_t offsets[256];
+		size_t offset = 0;
+		for (size_t digit = 256; digit > 0; digit--)
+		{
+			offsets[digit - 1] = offset;
+			offset += counts[byte][digit - 1];
+		}
+		for (size_t i = 0; i < count; i++)
+		{
+			to_p[offsets[(from_p[i].key >> shift) & 0xFF]++] = from_p[i];
+		}
+		List_Key_Entry* tmp_p = from_p;
+		from_p = to_p;
+		to_p = tmp_p;
+	}
+	return from_p;
+}
+
+/*
+ *  @brief Sort a given list by an integer key extracted from every element, highest key first.
+ *	   Each key is extracted exactly once and the list is radix sorted on them, so no comparison function is ever called.
+ *	   Elements with equal keys keep their order.
+ *  @param List_t* The list to sort.
+ *  @param List_Key_Fnc The function giving the key of an element.
+ *  @param size_t The number of low bytes of the keys that can differ, 4 for 32-bit keys and 8 for 64-bit keys.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Sort_By_Key(List_t* list_p, List_Key_Fnc key_fnc, size_t key_width) //safe
+{
+	if (NULL == list_p || NULL == key_fnc || 0 == key_width || sizeof(uint64_t) < key_width)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	size_t count = list_p->length;
+	if (2 > count || LIST_ERROR_SUCCESS != (ret_val = List_Unshare(list_p)))
+	{
+		goto exit;
+	}
+	List_Key_Entry stack_entries[2 * LIST_SORT_STACK_ENTRIES];
+	List_Sort_Entry stack_relink[LIST_SORT_STACK_ENTRIES];
+	List_Key_Entry* entries_p = (count <= LIST_SORT_STACK_ENTRIES) ? stack_entries : malloc(2 * count * sizeof(List_Key_Entry));
+	if (NULL == entries_p)
+	{
+		ret_val = LIST_ERROR_FAILURE;
+		goto exit;
+	}
+	size_t gathered = 0;
+	List_Walk walk;
+	List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), count);
+	while (gathered < count && LIST_POS_NONE != current_pos)
+	{
+		entries_p[gathered].entry.data_p = List_Pos_Data(current_pos, list_p);
+		entries_p[gathered].entry.pos = current_pos;
+		entries_p[gathered].key = key_fnc(entries_p[gathered].entry.data_p);
+		current_pos = List_Walk_Next(&walk);
+		gathered++;
+	}
+	List_Key_Entry* sorted_p = List_Radix_Sort(entries_p, entries_p + count, gathered, key_width);
+	//whichever half the sort didnt end in is free to hold the entries in the form List_Relink takes
+	List_Sort_Entry* relink_p = (stack_entries == entries_p) ? stack_relink
+		: (List_Sort_Entry*)((sorted_p == entries_p) ? entries_p + count : entries_p);
+	for (size_t i = 0; i < gathered; i++)
+	{
+		relink_p[i] = sorted_p[i].entry;
+	}
+	ret_val = List_Relink(relink_p, gathered, list_p);
+	if (list_p->heap)
+	{
+		List_Heap_Build(list_p);
+	}
+	if (stack_entries != entries_p)
+	{
+		free(entries_p);
+	}
+
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
 
+/*
+ *  @brief Sort a given list by keys built once per element, for when comparing the elements themselves is expensive.
+ *	   Every key is built up front, the list is merge sorted comparing only keys, then every key is freed.
+ *	   Elements with equal keys keep their order.
+ *  @param List_t* The list to sort.
+ *  @param List_Copy_Fnc The function building the key of an element, returning NULL on failure.
+ *  @param List_Cmp_Fnc The function describing the precedence of two keys.
+ *  @param List_Free_Fnc The function used to free a key once sorting is done.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur, in which case the list is untouched.
+ */
+List_Error_t List_Sort_Decorated(List_t* list_p, List_Copy_Fnc key_fnc, List_Cmp_Fnc key_cmp, List_Free_Fnc key_free) //safe
+{
+	if (NULL == list_p || NULL == key_fnc || NULL == key_cmp || NULL == key_free)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
 	List_Error_t ret_val = LIST_ERROR_SUCCESS;
 
 	pthread_mutex_lock(&(list_p->lock));
-	
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
+
+	size_t count = list_p->length;
+	if (2 > count || LIST_ERROR_SUCCESS != (ret_val = List_Unshare(list_p)))
+	{
+		goto exit;
+	}
+	List_Sort_Entry stack_entries[2 * LIST_SORT_STACK_ENTRIES];
+	List_Sort_Entry* entries_p = (count <= LIST_SORT_STACK_ENTRIES) ? stack_entries : malloc(2 * count * sizeof(List_Sort_Entry));
+	if (NULL == entries_p)
+	{
+		ret_val = LIST_ERROR_FAILURE;
+		goto exit;
+	}
+	//the entries carry the keys while sorting, the data is found again through each position afterwards
+	size_t built = 0;
+	List_Walk walk;
+	List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), count);
+	while (built < count && LIST_POS_NONE != current_pos)
+	{
+		entries_p[built].data_p = key_fnc(List_Pos_Data(current_pos, list_p));
+		if (NULL == entries_p[built].data_p)
+		{
+			ret_val = LIST_ERROR_BAD_ENTRY;
+			break;
+		}
+		entries_p[built].pos = current_pos;
+		current_pos = List_Walk_Next(&walk);
+		built++;
+	}
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		List_Merge_Sort(entries_p, entries_p + count, built, key_cmp);
+	}
+	//positions stay put until the relink, so every element can be found before any of them move
+	for (size_t i = 0; i < built; i++)
+	{
+		key_free(entries_p[i].data_p);
+		entries_p[i].data_p = List_Pos_Data(entries_p[i].pos, list_p);
+	}
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		ret_val = List_Relink(entries_p, built, list_p);
+		if (list_p->heap)
+		{
+			List_Heap_Build(list_p);
+		}
+	}
+	if (stack_entries != entries_p)
+	{
+		free(entries_p);
+	}
+
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
+}
+
+/*
+ *  @brief Move a range of elements between two lists whose nodes cant simply be relinked from one to the other.
+ *	   The elements are copied into a chain allocated all at once in the destination (or a gap opened in a ring)
+ *	   and then removed from the source, so if the room cant be allocated nothing moves at all.
+ *	   Both locks must be held and the caller is responsible for validating the range and any length limits.
+ *  @param List_t* The list to move elements into.
+ *  @param size_t The index in the destination list the first moved element should occupy.
+ *  @param List_t* The list to move elements out of, must differ from the destination list.
+ *  @param size_t The index of the first element to move.
+ *  @param size_t The number of elements to move, must be at least 1.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+static List_Error_t List_Move_Range(List_t* list_p, size_t at, List_t* other_p, size_t from, size_t count) //N/A
+{
+	List_Pos from_pos = List_Pos_At(from, other_p);
+	List_Pos source_pos = from_pos;
+	if (LIST_STORAGE_INDEX == list_p->storage)
+	{
+		List_Error_t ret_val = List_Index_Reserve(count, list_p);
+		if (LIST_ERROR_SUCCESS != ret_val)
+		{
+			return ret_val;
+		}
+		uint32_t first = LIST_INDEX_NONE;
+		uint32_t last = LIST_INDEX_NONE;
+		for (size_t i = 0; i < count && LIST_POS_NONE != source_pos; i++)
+		{
+			uint32_t slot = List_Index_Slot_Alloc(list_p);
+			List_Pos_Store(LIST_POS_OF_SLOT(slot), List_Pos_Data(source_pos, other_p), list_p);
+			LIST_SLOT_LINKS(list_p, slot)->previous = last;
+			if (LIST_INDEX_NONE != last)
+			{
+				LIST_SLOT_LINKS(list_p, last)->next = slot;
+			}
+			else
+			{
+				first = slot;
+			}
+			last = slot;
+			source_pos = List_Pos_Next(source_pos, other_p);
+		}
+		List_Index_Link_Range(first, last, count, at, list_p);
+	}
+	else if (LIST_STORAGE_RING == list_p->storage)
+	{
+		//heaps take new elements in at the end and sift each one up
+		if (list_p->heap)
+		{
+			at = list_p->length;
+		}
+		List_Error_t ret_val = List_Ring_Open(at, count, list_p);
+		if (LIST_ERROR_SUCCESS != ret_val)
+		{
+			return ret_val;
+		}
+		for (size_t i = 0; i < count && LIST_POS_NONE != source_pos; i++)
+		{
+			List_Pos_Store(LIST_POS_OF_RING(at + i), List_Pos_Data(source_pos, other_p), list_p);
+			if (list_p->heap)
+			{
+				List_Heap_Sift_Up(at + i, list_p);
+			}
+			source_pos = List_Pos_Next(source_pos, other_p);
+		}
+	}
+	else
+	{
+		List_Node* first_p = List_Node_Chain_Create(count, list_p);
+		if (NULL == first_p)
+		{
+			return LIST_ERROR_FAILURE;
+		}
+		List_Node* node_p = first_p;
+		List_Node* last_p = first_p;
+		for (size_t i = 0; i < count && LIST_POS_NONE != source_pos; i++)
+		{
+			List_Pos_Store((List_Pos)node_p, List_Pos_Data(source_pos, other_p), list_p);
+			last_p = node_p;
+			node_p = node_p->next_p;
+			source_pos = List_Pos_Next(source_pos, other_p);
+		}
+		List_Node_Link_Range(first_p, last_p, count, at, list_p);
+	}
+
+	//the destination owns the elements now, the source just lets go of them
+	if (LIST_STORAGE_RING == other_p->storage)
+	{
+		List_Ring_Erase(from, count, other_p);
+		if (other_p->heap)
+		{
+			List_Heap_Build(other_p);
+		}
+		return LIST_ERROR_SUCCESS;
+	}
+	source_pos = from_pos;
+	for (size_t i = 0; i < count && LIST_POS_NONE != source_pos; i++)
+	{
+		List_Pos next_pos = List_Pos_Next(source_pos, other_p);
+		List_Pos_Remove(source_pos, other_p);
+		source_pos = next_pos;
+	}
+	return LIST_ERROR_SUCCESS;
+}
+
+/*
+ *  @brief Move every node of one list onto the end of another without copying or allocating.
+ *	   The source list is left empty but still valid.
+ *  @param List_t* The list to append onto.
+ *  @param List_t* The list whose nodes should be moved, must differ from the first list.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Concat(List_t* list_p, List_t* other_p) //safe
+{
+	//check params, nodes can only move between lists of the same element size
+	if (NULL == list_p || NULL == other_p || list_p == other_p || list_p->elem_size != other_p->elem_size)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	List_Lock_Pair(list_p, other_p);
+
+	//make sure this wouldnt exceed length limits
+	if (list_p->max_length && list_p->length + other_p->length > list_p->max_length)
+	{
+		ret_val = LIST_ERROR_EXCEED_LIMIT;
+		goto exit;
+	}
+	if (LIST_ERROR_SUCCESS != (ret_val = List_Unshare(list_p)) || LIST_ERROR_SUCCESS != (ret_val = List_Unshare(other_p)))
+	{
+		goto exit;
+	}
+	//nodes move as they are laid out
+	List_Unreverse(list_p);
+	List_Unreverse(other_p);
+	if (0 != other_p->length && !List_Can_Relink(list_p, other_p))
+	{
+		ret_val = List_Move_Range(list_p, list_p->length, other_p, 0, other_p->length);
+	}
+	else if (0 != other_p->length && LIST_ERROR_SUCCESS == (ret_val = List_Node_Unpool_Range(other_p, other_p->head_p, other_p->length, list_p)))
+	{
+		//hand the whole chain over in one go
+		List_Node_Link_Range(other_p->head_p, other_p->tail_p, other_p->length, list_p->length, list_p);
+		other_p->head_p = NULL;
+		other_p->tail_p = NULL;
+		other_p->length = 0;
+	}
+
+exit:
+	List_Unlock_Pair(list_p, other_p);
+	return ret_val;
+}
+
+/*
+ *  @brief Move a range of nodes from one list into another at a given index without copying or allocating.
+ *  @param List_t* The list to move nodes into.
+ *  @param size_t The index in the destination list the first moved node should occupy.
+ *  @param List_t* The list to move nodes out of, must differ from the destination list.
+ *  @param size_t The index of the first node to move.
+ *  @param size_t The number of nodes to move.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Splice(List_t* list_p, size_t at, List_t* other_p, size_t from, size_t count) //safe
+{
+	//check params, nodes can only move between lists of the same element size
+	if (NULL == list_p || NULL == other_p || list_p == other_p || list_p->elem_size != other_p->elem_size)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	List_Lock_Pair(list_p, other_p);
+
+	//make sure both positions exist
+	if (at > list_p->length || from > other_p->length || count > other_p->length - from)
+	{
+		ret_val = LIST_ERROR_INVALID_PARAM;
+		goto exit;
+	}
+	//make sure this wouldnt exceed length limits
+	if (list_p->max_length && list_p->length + count > list_p->max_length)
+	{
+		ret_val = LIST_ERROR_EXCEED_LIMIT;
+		goto exit;
+	}
+	if (LIST_ERROR_SUCCESS != (ret_val = List_Unshare(list_p)) || LIST_ERROR_SUCCESS != (ret_val = List_Unshare(other_p)))
+	{
+		goto exit;
+	}
+	//nodes move as they are laid out
+	List_Unreverse(list_p);
+	List_Unreverse(other_p);
+	if (0 != count && !List_Can_Relink(list_p, other_p))
+	{
+		ret_val = List_Move_Range(list_p, at, other_p, from, count);
+	}
+	else if (0 != count && LIST_ERROR_SUCCESS == (ret_val = List_Node_Unpool_Range(other_p, List_Node_At(from, other_p), count, list_p)))
+	{
+		List_Node* first_p = NULL;
+		List_Node* last_p = NULL;
+		List_Node_Unlink_Range(from, count, other_p, &first_p, &last_p);
+		List_Node_Link_Range(first_p, last_p, count, at, list_p);
+	}
+
+exit:
+	List_Unlock_Pair(list_p, other_p);
+	return ret_val;
+}
+
+/*
+ *  @brief Split a list in two at a given index without copying or allocating nodes.
+ *	   The given list keeps every node before the index.
+ *  @param List_t* The list to split.
+ *  @param size_t The index of the first node to move into the new list.
+ *  @return List_t* A pointer to a newly allocated list holding every node from the index onward or NULL on error.
+ *	   The new list shares the given list's max length, cmp and free functions.
+ */
+List_t* List_Split(List_t* list_p, size_t at) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	//nobody else can see the new list yet so it needs no locking
+	List_t* split_list = List_Create_Like(list_p);
+	if (NULL == split_list)
+	{
+		return NULL;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	if (at > list_p->length || LIST_ERROR_SUCCESS != List_Unshare(list_p))
+	{
+		pthread_mutex_unlock(&(list_p->lock));
+		List_Destroy(split_list);
+		return NULL;
+	}
+	//nodes move as they are laid out
+	List_Unreverse(list_p);
+	size_t count = list_p->length - at;
+	if (0 != count)
+	{
+		//pool nodes cant leave their list, and compact lists and buffers cant share slots
+		List_Error_t moved = !List_Can_Relink(split_list, list_p)
+			? List_Move_Range(split_list, 0, list_p, at, count) : List_Node_Unpool_Range(list_p, List_Node_At(at, list_p), count, split_list);
+		if (LIST_ERROR_SUCCESS != moved)
+		{
+			pthread_mutex_unlock(&(list_p->lock));
+			List_Destroy(split_list);
+			return NULL;
+		}
+	}
+	if (0 != count && List_Can_Relink(split_list, list_p))
+	{
+		List_Node* first_p = NULL;
+		List_Node* last_p = NULL;
+		List_Node_Unlink_Range(at, count, list_p, &first_p, &last_p);
+		List_Node_Link_Range(first_p, last_p, count, 0, split_list);
+	}
+
+	pthread_mutex_unlock(&(list_p->lock));
+	return split_list;
+}
+
+/*
+ *  @brief Move a single node from one list to a given position in another.
+ *	   The node itself is relinked while both lists are locked, so observers of either list
+ *	   will always see the data in exactly one of them.
+ *  @param List_t* The list to move the node out of.
+ *  @param size_t The index of the node to move.
+ *  @param List_t* The list to move the node into, this may be the same list.
+ *  @param size_t The index the node should occupy in the destination list once moved.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Transfer(List_t* list_p, size_t from, List_t* other_p, size_t at) //safe
+{
+	//check params, nodes can only move between lists of the same element size
+	if (NULL == list_p || NULL == other_p || list_p->elem_size != other_p->elem_size)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+	bool same_list = (list_p == other_p);
+
+	if (same_list)
+	{
+		pthread_mutex_lock(&(list_p->lock));
+	}
+	else
+	{
+		List_Lock_Pair(list_p, other_p);
+	}
+
+	//make sure both positions exist, the destination is measured without the moving node
+	size_t other_length = same_list ? other_p->length - 1 : other_p->length;
+	if (from >= list_p->length || at > other_length)
+	{
+		ret_val = LIST_ERROR_INVALID_PARAM;
+		goto exit;
+	}
+	//make sure this wouldnt exceed length limits
+	if (!same_list && other_p->max_length && other_p->length >= other_p->max_length)
+	{
+		ret_val = LIST_ERROR_EXCEED_LIMIT;
+		goto exit;
+	}
+	if (LIST_ERROR_SUCCESS != (ret_val = List_Unshare(list_p)) || LIST_ERROR_SUCCESS != (ret_val = List_Unshare(other_p)))
+	{
+		goto exit;
+	}
+	//nodes move as they are laid out
+	List_Unreverse(list_p);
+	List_Unreverse(other_p);
+	if (same_list && LIST_STORAGE_INDEX == list_p->storage)
+	{
+		//the slot can be relinked where it is
+		uint32_t slot = List_Index_At(from, list_p);
+		List_Index_Unlink(slot, list_p);
+		List_Index_Link_Range(slot, slot, 1, at, list_p);
+	}
+	else if (same_list && LIST_STORAGE_RING == list_p->storage)
+	{
+		//a heap has nowhere else to put the element
+		if (!list_p->heap)
+		{
+			List_Ring_Rotate(from, at, list_p);
+		}
+	}
+	else if (!same_list && !List_Can_Relink(other_p, list_p))
+	{
+		ret_val = List_Move_Range(other_p, at, list_p, from, 1);
+	}
+	else if (same_list || LIST_ERROR_SUCCESS == (ret_val = List_Node_Unpool_Range(list_p, List_Node_At(from, list_p), 1, other_p)))
+	{
+		List_Node* node_p = NULL;
+		List_Node_Unlink_Range(from, 1, list_p, &node_p, &node_p);
+		List_Node_Link_Range(node_p, node_p, 1, at, other_p);
+	}
+
+exit:
+	if (same_list)
+	{
+		pthread_mutex_unlock(&(list_p->lock));
+	}
+	else
+	{
+		List_Unlock_Pair(list_p, other_p);
+	}
+	return ret_val;
+}
+
+/*
+ *  @brief Snapshot the data pointers of a list into a flat array, in list order, under a single lock.
+ *  @param List_t* The list to snapshot.
+ *  @param void** A caller provided array to fill or NULL to have one allocated (release it with free).
+ *  @param size_t The number of entries the caller provided array can hold, ignored when allocating.
+ *  @param size_t* A pointer in which to put the length of the list, which is also the number of entries written.
+ *	   This is set even when a caller provided array is too small, so the call can be retried.
+ *  @return void** The filled array or NULL on error.
+ */
+void** List_To_Array(List_t* list_p, void** array_p, size_t capacity, size_t* length_p) //safe
+{
+	//check params
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//the entries of a sized list point at its inline elements, which callers may write through
+	if (0 != list_p->elem_size && LIST_ERROR_SUCCESS != List_Unshare(list_p))
+	{
+		array_p = NULL;
+		goto exit;
+	}
+	size_t count = list_p->length;
+	if (NULL != length_p)
+	{
+		*length_p = count;
+	}
+	if (NULL == array_p)
+	{
+		//always hand back something the caller can free, even for an empty list
+		array_p = malloc((0 != count ? count : 1) * sizeof(void*));
+	}
+	else if (capacity < count)
+	{
+		array_p = NULL;
+	}
+	if (NULL == array_p)
+	{
+		goto exit;
+	}
+
+	//get the first position, an empty list will give none
+	List_Pos current_pos = List_Pos_First(list_p);
 	//loop till we are at the end
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+	for (size_t i = 0; i < count && LIST_POS_NONE != current_pos; i++)
 	{
-		//user validity check
-		if (NULL != valid_check && !valid_check(current_node->data_p))
+		array_p[i] = List_Pos_Data(current_pos, list_p);
+		current_pos = List_Pos_Next(current_pos, list_p);
+	}
+
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return array_p;
+}
+
+/*
+ *  @brief Create a list holding the entries of a flat array, in array order.
+ *	   Every node is allocated in a single block and linked in one pass.
+ *  @param void** The array of data to put into the list, no entry may be NULL.
+ *  @param size_t The number of entries in the array.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_From_Array(void** array_p, size_t count, size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free_fnc) //safe
+{
+	//check params
+	if ((NULL == array_p && 0 != count) || (max_length && count > max_length))
+	{
+		return NULL;
+	}
+	for (size_t i = 0; i < count; i++)
+	{
+		if (NULL == array_p[i])
 		{
-			ret_val = LIST_ERROR_BAD_ENTRY;
-			goto exit;
+			return NULL;
 		}
+	}
+
+	List_t* new_list_p = List_Create(max_length, cmp, free_fnc);
+	if (NULL == new_list_p || 0 == count)
+	{
+		return new_list_p;
+	}
+
+	List_Node* first_p = List_Node_Chain_Create(count, new_list_p);
+	if (NULL == first_p)
+	{
+		List_Destroy(new_list_p);
+		return NULL;
+	}
+	List_Node* current_node = first_p;
+	List_Node* last_p = first_p;
+	for (size_t i = 0; i < count; i++)
+	{
+		current_node->data_p = array_p[i];
+		last_p = current_node;
 		current_node = current_node->next_p;
 	}
+	//nobody else can see the new list yet so it needs no locking
+	List_Node_Link_Range(first_p, last_p, count, 0, new_list_p);
 
-exit:
-	pthread_mutex_unlock(&(list_p->lock));
-	return ret_val;
+	return new_list_p;
 }
 
 /*
- *  @brief Get the data in the node at the given location.
- *  @param size_t The index of the node in question.
- *  @param List_t* The list that contains the node in question.
- *  @return void* The data held within the node at the given location or NULL on error.
+ *  @brief Relocate every node of a list into one contiguous block laid out in traversal order.
+ *	   Pointer chasing through a compacted list walks memory sequentially instead of jumping around the heap.
+ *	   Any iterator currently on the list is invalidated.
+ *  @param List_t* The list to compact.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-void* List_At(size_t at, List_t* list_p) //safe
+List_Error_t List_Compact(List_t* list_p) //safe
 {
 	//check params
 	if (NULL == list_p)
 	{
-		return NULL;
+		return LIST_ERROR_INVALID_PARAM;
 	}
 
 	pthread_mutex_lock(&(list_p->lock));
-	List_Node* node_at_p = List_Node_At(at, list_p);
+	List_Error_t ret_val = List_Unshare(list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		ret_val = List_Compact_Locked(list_p);
+	}
 	pthread_mutex_unlock(&(list_p->lock));
 
-	if (NULL == node_at_p)
+	return ret_val;
+}
+
+/*
+ *  @brief Have a list compact itself automatically once enough nodes have been inserted or removed.
+ *	   The check runs after each insertion or removal, so iterators must not be held across those while this is enabled.
+ *  @param List_t* The list to configure.
+ *  @param size_t The number of nodes linked or unlinked since the last compaction, as a percentage of the
+ *	   current length, that triggers the next one. 0 disables automatic compaction (the default).
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Set_Compact_Threshold(List_t* list_p, size_t percent) //safe
+{
+	//check params
+	if (NULL == list_p)
 	{
-		return NULL;
+		return LIST_ERROR_INVALID_PARAM;
 	}
 
-	return node_at_p->data_p;
+	pthread_mutex_lock(&(list_p->lock));
+	list_p->compact_threshold = percent;
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return LIST_ERROR_SUCCESS;
 }
 
 /*
- *  @brief Put data into the end of a given list.
- *  @param void* The data to insert to the end of the list.
- *  @param List_t* The list that should contain the given node.
+ *  @brief Set how far ahead of themselves walks over a list fetch elements into cache.
+ *	   Scans such as List_Find, List_For_Each, List_Reduce and List_Copy keep a second cursor this many elements ahead,
+ *	   fetching its nodes and the caller data they hold, so a list scattered over more memory than the cache
+ *	   waits on memory less often. Sized ring storage is never fetched ahead since the hardware does that itself.
+ *  @param List_t* The list to configure.
+ *  @param size_t The number of elements to fetch ahead, 0 to not fetch ahead at all. The default is 8, the most 256.
  *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Error_t List_Push(void* data_p, List_t* list_p) //safe
+List_Error_t List_Set_Prefetch_Distance(List_t* list_p, size_t distance) //safe
 {
-	//check param
-	if (NULL == list_p || NULL == data_p)
+	//check params
+	if (NULL == list_p || LIST_PREFETCH_MAX < distance)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
-	return List_Insert(data_p, list_p->length, list_p); //safe call
+
+	pthread_mutex_lock(&(list_p->lock));
+	list_p->prefetch_distance = distance;
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return LIST_ERROR_SUCCESS;
 }
 
 /*
- *  @brief Put data into the beginning of a given list.
- *  @param void* The data to insert to the end of the list.
- *  @param List_t* The list that should contain the given node.
+ *  @brief Remove the element at a given position from a list whose lock is held, copying it out first.
+ *  @param List_Pos The position to remove.
+ *  @param List_t* The list that contains the position.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise. May be NULL.
  *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Error_t List_Unshift(void* data_p, List_t* list_p) //safe
+static List_Error_t List_Pos_Take(List_Pos pos, List_t* list_p, void* out_p) //N/A
 {
-	//check param
-	if (NULL == list_p || NULL == data_p)
+	if (LIST_POS_NONE == pos)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
-	return List_Insert(data_p, 0, list_p); //safe call
+	if (NULL != out_p)
+	{
+		void* data_p = List_Pos_Data(pos, list_p);
+		if (0 != list_p->elem_size)
+		{
+			memcpy(out_p, data_p, list_p->elem_size);
+		}
+		else
+		{
+			memcpy(out_p, &data_p, sizeof(void*));
+		}
+	}
+	List_Error_t ret_val = List_Pos_Remove(pos, list_p);
+	List_Compact_Check(list_p);
+	return ret_val;
 }
 
 /*
- *  @brief Put data into the given index of a given list.
- *  @param void* The data to insert to the list.
- *  @param size_t The index in which to insert the given data to.
- *  @param List_t* The list that should contain the given node.
+ *  @brief Remove a given index from the list, copying its element out.
+ *	   This is how elements are taken out of sized lists, where the element lives inside the node.
+ *  @param size_t The index to remove from the list.
+ *  @param List_t* The list to remove the given index from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise.
+ *	   May be NULL to just drop the node without freeing anything.
  *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Error_t List_Insert(void* data_p, size_t at, List_t* list_p) //safe
+List_Error_t List_Remove_At_Into(size_t at, List_t* list_p, void* out_p) //safe
 {
-	//check param
-	if (NULL == list_p || NULL == data_p)
+	//check params
+	if (NULL == list_p)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
 
-	//try to allocate the node
-	List_Node* new_node_p = List_Node_Create(data_p);
-	//make sure it was allocated properly
-	if (NULL == new_node_p)
+	pthread_mutex_lock(&(list_p->lock));
+	List_Error_t ret_val = List_Unshare(list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		ret_val = List_Pos_Take(List_Pos_At(at, list_p), list_p, out_p);
+	}
+	pthread_mutex_unlock(&(list_p->lock));
+
+	return ret_val;
+}
+
+/*
+ *  @brief Remove the last node from the list, copying its element out.
+ *  @param List_t* The list to remove the last node from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise. May be NULL.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Pop_Into(List_t* list_p, void* out_p) //safe
+{
+	//check params
+	if (NULL == list_p)
 	{
-		return LIST_ERROR_BAD_ENTRY;
+		return LIST_ERROR_INVALID_PARAM;
 	}
-	//at is checked in insert node
 
 	pthread_mutex_lock(&(list_p->lock));
-	List_Error_t ret_val = List_Node_Insert(new_node_p, at, list_p);
+	List_Error_t ret_val = List_Unshare(list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		ret_val = List_Pos_Take(List_Pos_Last(list_p), list_p, out_p);
+	}
 	pthread_mutex_unlock(&(list_p->lock));
 
 	return ret_val;
 }
 
 /*
- *  @brief Find the first instance of a given search data using the defined compare function.
- *  @param void* The data to use as a 'search term'.
- *  @param List_t* The list that should contain the given search term.
- 		The function uses the list's cmp function to decide if a node is "equal" to the search term.
-		 If the cmp function is not defined, the function will assume that all nodes are the same,
-		 	therefore returning the first node it 'sees'.
- *  @param size_t* A pointer in which to put the index if any should be found.
-	   Note that this will not be changed if no match is found.
- *  @return List_Error_t LIST_ERROR_SUCCESS on successful find, LIST_ERROR_EXCEED_LIMIT if not found in list,
- 						or any error that may occur.
+ *  @brief Remove the first node from the list, copying its element out.
+ *  @param List_t* The list to remove the first node from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise. May be NULL.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Error_t List_Find(void* search_data_p, List_t* list_p, size_t* response) //safe
+List_Error_t List_Shift_Into(List_t* list_p, void* out_p) //safe
 {
 	//check params
-	if (NULL == list_p || NULL == search_data_p)
+	if (NULL == list_p)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
-	List_Error_t ret_val = LIST_ERROR_SUCCESS;
 
 	pthread_mutex_lock(&(list_p->lock));
+	List_Error_t ret_val = List_Unshare(list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		ret_val = List_Pos_Take(List_Pos_First(list_p), list_p, out_p);
+	}
+	pthread_mutex_unlock(&(list_p->lock));
 
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the end
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+	return ret_val;
+}
+
+/*
+ *  @brief Find the element with the most precedence by the list's cmp function, the first of them on ties.
+ *	   This is the first element of a heap, any other list is scanned.
+ *  @param List_t* The list to search, its lock must be held.
+ *  @return List_Pos The position of the element or LIST_POS_NONE if the list is empty.
+ */
+static List_Pos List_Pos_Max(List_t* list_p) //N/A
+{
+	List_Pos max_pos = List_Pos_First(list_p);
+	if (list_p->heap || NULL == list_p->cmp)
 	{
-		//make sure the node is valid
-		if (NULL != current_node)
-		{
-			//check if this node is the right one
-			int nodes_match = 0;
-			//null cmp function should result in 0
-			if (NULL != list_p->cmp)
-			{
-				nodes_match = list_p->cmp(search_data_p, current_node->data_p);
-			}
-			if (0 == nodes_match)
-			{
-				if (NULL != response)
-				{
-					*response = i;
-				}
-				//return success code
-				goto exit;
-			}
-			//otherwise, just try the next node
-			current_node = current_node->next_p;
-		}
-		else
+		return max_pos;
+	}
+	void* max_data_p = (LIST_POS_NONE != max_pos) ? List_Pos_Data(max_pos, list_p) : NULL;
+	for (List_Pos current_pos = max_pos; LIST_POS_NONE != current_pos; current_pos = List_Pos_Next(current_pos, list_p))
+	{
+		void* data_p = List_Pos_Data(current_pos, list_p);
+		if (0 < list_p->cmp(data_p, max_data_p))
 		{
-			//we have hit a dead end
-			ret_val = LIST_ERROR_BAD_ENTRY;
-			goto exit;
+			max_pos = current_pos;
+			max_data_p = data_p;
 		}
 	}
+	return max_pos;
+}
 
-	//return success code
-	ret_val = LIST_ERROR_EXCEED_LIMIT;
-exit:
+/*
+ *  @brief Get the data with the most precedence in a list without removing it.
+ *	   This is O(1) for lists made with List_Create_Heap and a scan for any other list.
+ *  @param List_t* The list in question.
+ *  @return void* The data, a pointer to the inline element for sized lists, or NULL on error.
+ */
+void* List_Peek_Max(List_t* list_p) //safe
+{
+	if (NULL == list_p)
+	{
+		return NULL;
+	}
+	void* ret_val = NULL;
+
+	pthread_mutex_lock(&(list_p->lock));
+	List_Pos pos = List_Pos_Max(list_p);
+	if (LIST_POS_NONE != pos)
+	{
+		ret_val = List_Pos_Data(pos, list_p);
+	}
 	pthread_mutex_unlock(&(list_p->lock));
+
 	return ret_val;
 }
 
 /*
- *  @brief Test each node in a list using a given find function until an entry passes or no entries are left.
- *  @param List_t* The list to test entries within.
- *  @param List_Find_Fnc The function to test each entry using.
-	   A test is passed when this function returns true after being given data.
- *  @return bool True if an entry is found that passes the given test or false if no nodes pass or an error occurs.
+ *  @brief Remove the data with the most precedence from a list.
+ *	   This is O(log n) for lists made with List_Create_Heap and a scan for any other list.
+ *  @param List_t* The list to remove from, sized lists need List_Pop_Max_Into.
+ *  @return void* The data that was removed or NULL on error.
  */
-bool List_Some(List_t* list_p, List_Find_Fnc do_fnc) //safe
+void* List_Pop_Max(List_t* list_p) //safe
 {
-	//check params
-	if (NULL == list_p || NULL == do_fnc)
+	void* ret_val = NULL;
+	if (NULL == list_p || 0 != list_p->elem_size || LIST_ERROR_SUCCESS != List_Pop_Max_Into(list_p, &ret_val))
 	{
-		return false;
+		return NULL;
 	}
-	bool ret_val = false;
-
-	pthread_mutex_lock(&(list_p->lock));
+	return ret_val;
+}
 
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the end
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+/*
+ *  @brief Remove the data with the most precedence from a list, copying it out.
+ *  @param List_t* The list to remove from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Pop_Max_Into(List_t* list_p, void* out_p) //safe
+{
+	if (NULL == list_p || NULL == out_p)
 	{
-		//make sure the node is valid
-		if (NULL != current_node)
-		{
-			//check if this node is the right one
-			bool node_found = do_fnc(current_node->data_p);
-			if (node_found)
-			{
-				ret_val = true;
-				goto exit;
-			}
-		}
-		else
-		{
-			//we have hit a dead end
-			goto exit;
-		}
-		current_node = current_node->next_p;
+		return LIST_ERROR_INVALID_PARAM;
 	}
 
-	//we didnt find a match
-exit:
+	pthread_mutex_lock(&(list_p->lock));
+	List_Error_t ret_val = List_Unshare(list_p);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		ret_val = List_Pos_Take(List_Pos_Max(list_p), list_p, out_p);
+	}
 	pthread_mutex_unlock(&(list_p->lock));
+
 	return ret_val;
 }
 
 /*
- *  @brief Test each node in a list using a given find function until an entry fails or no entries are left.
- *  @param List_t* The list to test entries within.
- *  @param List_Find_Fnc The function to test each entry using.
-	   A test is passed when this function returns true after being given data and failed if false is returned.
- *  @return bool True if all entries pass th egiven test or false when one fails or an error occurs.
+ *  @brief Empty a heap into a new list sorted from most to least precedence, heapsorting the elements in place.
+ *	   The new list is a deque that takes over the heap's array, so the only allocation is the list itself.
+ *  @param List_t* A list made with List_Create_Heap or List_Create_Heap_Sized, left empty but still valid.
+ *  @return List_t* A pointer to the sorted list or NULL on error, in which case the heap is untouched.
  */
-bool List_Every(List_t* list_p, List_Find_Fnc do_fnc) //safe
+List_t* List_Heap_Drain(List_t* list_p) //safe
 {
-	//check params
-	if (NULL == list_p || NULL == do_fnc)
+	if (NULL == list_p || !list_p->heap)
 	{
-		return false;
+		return NULL;
+	}
+	List_t* sorted_list = List_Alloc(list_p->max_length, list_p->cmp, list_p->free, list_p->elem_size, LIST_STORAGE_RING);
+	if (NULL == sorted_list)
+	{
+		return NULL;
 	}
-	bool ret_val = true;
 
 	pthread_mutex_lock(&(list_p->lock));
 
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the end
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+	if (LIST_ERROR_SUCCESS != List_Unshare(list_p))
+	{
+		pthread_mutex_unlock(&(list_p->lock));
+		List_Destroy(sorted_list);
+		return NULL;
+	}
+	//move the root behind the shrinking heap until nothing is left, leaving the least precedence first
+	for (size_t end = list_p->length; end > 1; end--)
+	{
+		List_Ring_Swap(0, end - 1, list_p);
+		List_Heap_Sift_Down(0, end - 1, list_p);
+	}
+	List_Ring_Reverse(0, list_p->length, list_p);
+
+	sorted_list->slots_p = list_p->slots_p;
+	sorted_list->slot_capacity = list_p->slot_capacity;
+	sorted_list->ring_head = list_p->ring_head;
+	sorted_list->length = list_p->length;
+	list_p->slots_p = NULL;
+	List_Index_Release(list_p);
+
+	pthread_mutex_unlock(&(list_p->lock));
+	return sorted_list;
+}
+
+/*
+ *  @brief An element gathered up for selection.
+ *	   Its index breaks ties between elements of equal precedence, earlier elements winning, just like a stable sort.
+ */
+typedef struct List_Select_Entry
+{
+	void* data_p;
+	size_t at;
+}
+List_Select_Entry;
+
+/*
+ *  @brief Compare two selection entries by precedence, falling back to their indices so no two are ever equal.
+ *  @param const List_Select_Entry* The first entry.
+ *  @param const List_Select_Entry* The second entry.
+ *  @param List_Cmp_Fnc The function describing precedence, NULL for everything being equal.
+ *  @return int Greater than 0 if the first entry has precedence, less than 0 if the second does.
+ */
+static int List_Select_Cmp(const List_Select_Entry* a_p, const List_Select_Entry* b_p, List_Cmp_Fnc cmp_fnc) //N/A
+{
+	int ret_val = (NULL != cmp_fnc) ? cmp_fnc(a_p->data_p, b_p->data_p) : 0;
+	if (0 != ret_val)
+	{
+		return ret_val;
+	}
+	return (a_p->at < b_p->at) ? 1 : -1;
+}
+
+/*
+ *  @brief Move an entry of a bounded selection heap down until neither child belongs closer to the root.
+ *	   Keeping the top of a list the weakest entry is at the root, keeping the bottom the strongest is.
+ *  @param List_Select_Entry* The heap.
+ *  @param size_t The index of the entry to move.
+ *  @param size_t The number of entries in the heap.
+ *  @param List_Cmp_Fnc The function describing precedence.
+ *  @param int -1 when keeping the top of a list, 1 when keeping the bottom.
+ *  @return void.
+ */
+static void List_Select_Sift_Down(List_Select_Entry* heap_p, size_t at, size_t count, List_Cmp_Fnc cmp_fnc, int side) //N/A
+{
+	List_Select_Entry entry = heap_p[at];
+	size_t child = 2 * at + 1;
+	while (child < count)
+	{
+		if (child + 1 < count && 0 < side * List_Select_Cmp(&(heap_p[child + 1]), &(heap_p[child]), cmp_fnc))
+		{
+			child++;
+		}
+		if (0 >= side * List_Select_Cmp(&(heap_p[child]), &entry, cmp_fnc))
+		{
+			break;
+		}
+		heap_p[at] = heap_p[child];
+		at = child;
+		child = 2 * at + 1;
+	}
+	heap_p[at] = entry;
+}
+
+/*
+ *  @brief Gather the strongest or weakest elements of a list into a bounded heap in one pass, in O(n log keep).
+ *  @param List_t* The list to select from, its lock must be held.
+ *  @param size_t The number of elements to keep, no more than the length of the list and at least 1.
+ *  @param List_Cmp_Fnc The function describing precedence.
+ *  @param int -1 to keep the elements with the most precedence, 1 to keep those with the least.
+ *  @param List_Select_Entry* Room for keep entries, filled as a heap whose root is the kept element closest to the rest.
+ *  @return void.
+ */
+static void List_Select(List_t* list_p, size_t keep, List_Cmp_Fnc cmp_fnc, int side, List_Select_Entry* heap_p) //N/A
+{
+	List_Walk walk;
+	List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+	for (size_t at = 0; LIST_POS_NONE != current_pos; at++)
 	{
-		//make sure the node is valid
-		//im not including contingency "else" on purpose
-		if (NULL != current_node)
+		List_Select_Entry entry = { List_Pos_Data(current_pos, list_p), at };
+		if (at < keep)
 		{
-			//check if this node fails
-			bool node_failed = do_fnc(current_node->data_p);
-			if (!node_failed)
+			heap_p[at] = entry;
+			//heapify once the heap is full rather than sifting every element up
+			if (at + 1 == keep)
 			{
-				ret_val = false;
-				goto exit;
+				for (size_t i = keep / 2; i > 0; i--)
+				{
+					List_Select_Sift_Down(heap_p, i - 1, keep, cmp_fnc, side);
+				}
 			}
 		}
-		current_node = current_node->next_p;
+		else if (0 < side * List_Select_Cmp(&(heap_p[0]), &entry, cmp_fnc))
+		{
+			//the root is the first to go when something better comes along
+			heap_p[0] = entry;
+			List_Select_Sift_Down(heap_p, 0, keep, cmp_fnc, side);
+		}
+		current_pos = List_Walk_Next(&walk);
 	}
-
-	//we didnt find a failure!
-exit:
-	pthread_mutex_unlock(&(list_p->lock));
-	return ret_val;
 }
 
 /*
- *  @brief Run a given function against all data entries within a list.
- *  @param List_t* The list to test entries within.
- *  @param List_Do_Fnc The function to run with each entry.
- *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *  @brief Add the k elements with the most precedence in a list to the end of another list, most precedence first,
+ *	   without sorting or reordering the list itself. Runs in O(n log k).
+ *	   Elements of equal precedence are taken in list order, so the result matches the start of the list after List_Sort.
+ *  @param List_t* The list to select from.
+ *  @param size_t The number of elements to take, all of them if the list is shorter.
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use.
+						If NULL is used here, the list's default cmp function will be used
+ *  @param List_t* The list to add the elements to, which must have the same element size.
+ *	   The data is shared with the list it came from, so a list of pointers should not free it too.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur, in which case nothing is added.
  */
-List_Error_t List_For_Each(List_t* list_p, List_Do_Fnc do_fnc) //safe
+List_Error_t List_Top_K(List_t* list_p, size_t k, List_Cmp_Fnc cmp_fnc, List_t* out_p) //safe
 {
-	//check params
-	if (NULL == list_p || NULL == do_fnc)
+	if (NULL == list_p || NULL == out_p || list_p == out_p || list_p->elem_size != out_p->elem_size)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
 	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+	//the result is staged in a private deque, then handed over with all of List_Concat's checks
+	List_t* top_list = List_Alloc(0, NULL, NULL, list_p->elem_size, LIST_STORAGE_RING);
+	if (NULL == top_list)
+	{
+		return LIST_ERROR_FAILURE;
+	}
+	List_Select_Entry stack_entries[LIST_SORT_STACK_ENTRIES];
+	List_Select_Entry* heap_p = stack_entries;
 
 	pthread_mutex_lock(&(list_p->lock));
 
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the end
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+	if (NULL == cmp_fnc)
 	{
-		//make sure the node is valid
-		if (NULL != current_node)
-		{
-			do_fnc(current_node->data_p);
-		}
-		else
-		{
-			ret_val = LIST_ERROR_BAD_ENTRY;
-			goto exit;
-		}
-		current_node = current_node->next_p;
+		cmp_fnc = list_p->cmp;
+	}
+	size_t keep = (k < list_p->length) ? k : list_p->length;
+	if (0 == keep)
+	{
+		pthread_mutex_unlock(&(list_p->lock));
+		goto exit;
+	}
+	if (keep > LIST_SORT_STACK_ENTRIES)
+	{
+		heap_p = malloc(keep * sizeof(List_Select_Entry));
+	}
+	if (NULL == heap_p || LIST_ERROR_SUCCESS != List_Ring_Open(0, keep, top_list))
+	{
+		pthread_mutex_unlock(&(list_p->lock));
+		ret_val = LIST_ERROR_FAILURE;
+		goto exit;
+	}
+	List_Select(list_p, keep, cmp_fnc, -1, heap_p);
+	//the weakest kept element is at the root, so taking it each time fills the deque from the back
+	for (size_t count = keep; count > 0; count--)
+	{
+		//sized elements are copied now, before the list can change under them
+		List_Pos_Store(LIST_POS_OF_RING(count - 1), heap_p[0].data_p, top_list);
+		heap_p[0] = heap_p[count - 1];
+		List_Select_Sift_Down(heap_p, 0, count - 1, cmp_fnc, -1);
 	}
 
-exit:
 	pthread_mutex_unlock(&(list_p->lock));
+
+	ret_val = List_Concat(out_p, top_list); //safe call
+
+exit:
+	if (stack_entries != heap_p)
+	{
+		free(heap_p);
+	}
+	//the private deque has no free function, so anything left in it is not freed twice
+	List_Destroy(top_list);
 	return ret_val;
 }
 
 /*
- *  @brief Remove a given index from the list.
- *  @param size_t The index to remove from the list.
- *  @param List_t* The list to remove the given index from.
- *  @return void* The data held within the removed node or NULL on error.
+ *  @brief Get the element that would be at a given index were the list sorted, without sorting or reordering it.
+ *	   Only the smaller side of the list around that index is ever held, so this runs in O(n log min(n + 1, length - n)).
+ *	   Elements of equal precedence are ordered as List_Sort would leave them.
+ *  @param List_t* The list in question.
+ *  @param size_t The index in sorted order, 0 being the element with the most precedence.
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use.
+						If NULL is used here, the list's default cmp function will be used
+ *  @return void* The data, a pointer to the inline element for sized lists, or NULL on error.
  */
-void* List_Remove_At(size_t at, List_t* list_p) //safe
+void* List_Nth_Element(List_t* list_p, size_t n, List_Cmp_Fnc cmp_fnc) //safe
 {
-	//check params
-	if (NULL == list_p || at > list_p->length)
+	if (NULL == list_p)
 	{
 		return NULL;
 	}
 	void* ret_val = NULL;
+	List_Select_Entry stack_entries[LIST_SORT_STACK_ENTRIES];
+	List_Select_Entry* heap_p = stack_entries;
 
 	pthread_mutex_lock(&(list_p->lock));
 
-	//find the node
-	List_Node* node = List_Node_At(at, list_p);
-	if (NULL == node)
+	if (n >= list_p->length)
 	{
-		ret_val = NULL;
 		goto exit;
 	}
-	//save the nodes data
-	void* node_data = node->data_p;
-	//remove the node
-	List_Error_t removed_node = List_Node_Remove(node, list_p);
-	if (LIST_ERROR_SUCCESS != removed_node)
+	if (NULL == cmp_fnc)
+	{
+		cmp_fnc = list_p->cmp;
+	}
+	//keep the n + 1 strongest and take the weakest of them, or the length - n weakest and take the strongest
+	int side = (n < list_p->length / 2) ? -1 : 1;
+	size_t keep = (-1 == side) ? n + 1 : list_p->length - n;
+	if (keep > LIST_SORT_STACK_ENTRIES)
+	{
+		heap_p = malloc(keep * sizeof(List_Select_Entry));
+	}
+	if (NULL == heap_p)
 	{
-		ret_val = NULL;
 		goto exit;
 	}
-	ret_val = node_data;
+	List_Select(list_p, keep, cmp_fnc, side, heap_p);
+	ret_val = heap_p[0].data_p;
+	if (stack_entries != heap_p)
+	{
+		free(heap_p);
+	}
 
 exit:
 	pthread_mutex_unlock(&(list_p->lock));
-	//return data
 	return ret_val;
 }
 
 /*
- *  @brief Remove a given index from the list and destroy the data held within it.
- *  @param size_t The index to delete from the list.
- *  @param List_t* The list to delete the given index from.
- *  @return void.
+ *  @brief Lock a list and start walking it in order, for LIST_FOREACH.
+ *  @param List_t* The list to walk, NULL for nothing to walk.
+ *  @return List_Foreach_t The state of the walk, which must be handed to List_Foreach_End when it is active.
  */
-void List_Delete_At(size_t at, List_t* list_p) //safe
+List_Foreach_t List_Foreach_Begin(List_t* list_p) //safe
 {
-	//check params
-	if (NULL == list_p || at > list_p->length)
-	{
-		return;
-	}
-
-	//find the node and delete it
-	void* removing_node_data = List_Remove_At(at, list_p); //safe call
-	//i dont see how anyone else could have a handle on removing_node_data by this point
-	if (NULL != removing_node_data)
+	List_Foreach_t foreach = { list_p, NULL, LIST_POS_NONE, false, false };
+	if (NULL == list_p)
 	{
-		//we should be on the correct node data, free it
-		if (NULL != list_p->free)
-		{
-			list_p->free(removing_node_data); //setting to null wont do anything
-		}
+		return foreach;
 	}
+	pthread_mutex_lock(&(list_p->lock));
+	//List_Foreach_Next follows nodes inline as they are laid out, reversed lists are stepped
+	foreach.nodes = (LIST_STORAGE_NODES == list_p->storage) && !list_p->reversed;
+	foreach.node_p = (List_Node_Head*)list_p->head_p;
+	foreach.pos = foreach.nodes ? LIST_POS_NONE : List_Pos_First(list_p);
+	foreach.active = true;
+	return foreach;
 }
 
 /*
- *  @brief Remove the last node from the list.
- *  @param List_t* The list to remove the last node from.
- *  @return void* The data held within the removed node or NULL on error.
+ *  @brief Step a walk over a list that isnt made of nodes, which List_Foreach_Next cant follow inline.
+ *  @param List_Foreach_t* The state of the walk, whose list is locked.
+ *  @return void* The data of the next element or NULL at the end.
  */
-void* List_Pop(List_t* list_p) //safe
+void* List_Foreach_Step(List_Foreach_t* foreach_p) //N/A
 {
-	//check params
-	if (NULL == list_p)
+	if (LIST_POS_NONE == foreach_p->pos)
 	{
 		return NULL;
 	}
-
-	//get the head node, an empty list will give NULL
-	void* removing_node_data = List_Remove_At(list_p->length-1, list_p); //safe call
-
-	//we should be on the correct node data, return it
-	return removing_node_data;
+	void* data_p = List_Pos_Data(foreach_p->pos, foreach_p->list_p);
+	foreach_p->pos = List_Pos_Next(foreach_p->pos, foreach_p->list_p);
+	return data_p;
 }
 
 /*
- *  @brief Remove the first node from the list.
- *  @param List_t* The list to remove the first node from.
- *  @return void* The data held within the removed node or NULL on error.
+ *  @brief Finish walking a list, unlocking it.
+ *  @param List_Foreach_t* The state of the walk.
+ *  @return void.
  */
-void* List_Shift(List_t* list_p) //safe
+void List_Foreach_End(List_Foreach_t* foreach_p) //safe
 {
-	//check params
-	if (NULL == list_p)
+	if (foreach_p->active)
 	{
-		return NULL;
+		foreach_p->active = false;
+		pthread_mutex_unlock(&(foreach_p->list_p->lock));
 	}
-
-	//get the head node, an empty list will give NULL
-	void* removing_node_data = List_Remove_At(0, list_p); //safe call
-
-	//we should be on the correct node data, return it
-	return removing_node_data;
 }
 
 /*
- *  @brief 					- Create an iterator for in-order procession through items in the given list.
- *  @param List_p 			- A pointer to the list to create an iterator for.
- *  @return List_Iterator_p - A pointer to an allocated list iterator or NULL on failure.
+ *  @brief Walk a list under its lock, gathering its data pointers into chunks and handing each chunk to a callback.
+ *  @param List_t* The list to walk.
+ *  @param size_t The most data pointers in a chunk, 0 for LIST_CHUNK_STACK_ITEMS.
+ *  @param List_Chunk_Fnc The callback for every chunk, or NULL to use find_fnc instead.
+ *  @param List_Chunk_Find_Fnc The callback for every chunk until one returns true, used when do_fnc is NULL.
+ *  @param void* The context pointer handed to the callback.
+ *  @param bool* A pointer in which to put whether find_fnc returned true, may be NULL.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Iterator_p List_Iterator_Create(List_p list_p)
+static List_Error_t List_Walk_Chunks(List_t* list_p, size_t chunk_size, List_Chunk_Fnc do_fnc, List_Chunk_Find_Fnc find_fnc,
+	void* ctx_p, bool* found_p) //N/A
 {
-	List_Iterator_p iter_p = NULL;
-	if (NULL != list_p)
+	if (0 == chunk_size)
 	{
-		iter_p = calloc(1, sizeof(List_Iterator_t));
-		if (NULL != iter_p)
+		chunk_size = LIST_CHUNK_STACK_ITEMS;
+	}
+	void* stack_items[LIST_CHUNK_STACK_ITEMS];
+	void** items_p = (chunk_size <= LIST_CHUNK_STACK_ITEMS) ? stack_items : malloc(chunk_size * sizeof(void*));
+	if (NULL == items_p)
+	{
+		return LIST_ERROR_FAILURE;
+	}
+	bool found = false;
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	//inline elements may be written in place, caller pointers are the caller's own
+	if (NULL != do_fnc && 0 != list_p->elem_size)
+	{
+		ret_val = List_Unshare(list_p);
+	}
+	List_Walk walk;
+	List_Pos first_pos = (LIST_ERROR_SUCCESS == ret_val) ? List_Pos_First(list_p) : LIST_POS_NONE;
+	List_Pos current_pos = List_Walk_Begin(&walk, list_p, first_pos, list_p->length);
+	while (!found && LIST_POS_NONE != current_pos)
+	{
+		size_t count = 0;
+		while (count < chunk_size && LIST_POS_NONE != current_pos)
 		{
-			iter_p->list_p = list_p;
-			iter_p->curr_p = NULL;
-			iter_p->flags = 0;
+			items_p[count++] = List_Pos_Data(current_pos, list_p);
+			current_pos = List_Walk_Next(&walk);
+		}
+		if (NULL != do_fnc)
+		{
+			do_fnc(items_p, count, ctx_p);
+		}
+		else
+		{
+			found = find_fnc(items_p, count, ctx_p);
 		}
 	}
-	return iter_p;
+
+	pthread_mutex_unlock(&(list_p->lock));
+
+	if (stack_items != items_p)
+	{
+		free(items_p);
+	}
+	if (NULL != found_p)
+	{
+		*found_p = found;
+	}
+	return ret_val;
 }
+
 /*
- *  @brief 					- Create a iterator for reversed-order procession through items in the given list.
- *  @param List_p 			- A pointer to the list to create a iterator for.
- *  @return List_Iterator_p - A pointer to an allocated list iterator or NULL on failure.
+ *  @brief Perform a function on the data of a list a chunk at a time, so the function can loop over plain arrays.
+ *  @param List_t* The list to perform the function on.
+ *  @param List_Chunk_Fnc The function, given an array of data pointers in list order, their count and the context pointer.
+ *  @param size_t The most data pointers handed over at once, 0 for a default of 64. Only the last chunk may be smaller.
+ *  @param void* A context pointer handed to every call, such as an accumulator.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Iterator_p List_Iterator_Create_Reverse(List_p list_p) //safe
+List_Error_t List_For_Each_Chunk(List_t* list_p, List_Chunk_Fnc chunk_fnc, size_t chunk_size, void* ctx_p) //safe
 {
-	List_Iterator_p iter_p = NULL;
-	if (NULL != list_p)
+	if (NULL == list_p || NULL == chunk_fnc)
 	{
-		iter_p = calloc(1, sizeof(List_Iterator_t));
-		if (NULL != iter_p)
-		{
-			iter_p->list_p = list_p;
-			iter_p->curr_p = NULL;
-			iter_p->flags = LIST_ITER_FLAG_REVERSE;
-		}
+		return LIST_ERROR_INVALID_PARAM;
 	}
-	return iter_p;
+	return List_Walk_Chunks(list_p, chunk_size, chunk_fnc, NULL, ctx_p, NULL);
 }
+
 /*
- *  @brief 					- Copy an iterator to a newly allocated iterator.
- *  @param List_Iterator_p	- A pointer to the iterator to copy.
- *  @return List_Iterator_p - A pointer to a copied list iterator or NULL on failure.
+ *  @brief Check the data of a list a chunk at a time, stopping at the first chunk the function returns true for.
+ *  @param List_t* The list to check.
+ *  @param List_Chunk_Find_Fnc The function, given an array of data pointers in list order, their count and the context pointer.
+ *  @param size_t The most data pointers handed over at once, 0 for a default of 64. Only the last chunk may be smaller.
+ *  @param void* A context pointer handed to every call, such as where to record which element matched.
+ *  @return bool True if the function returned true for any chunk, false otherwise or on error.
  */
-List_Iterator_p List_Iterator_Copy(List_Iterator_p iter_p)
+bool List_Some_Chunk(List_t* list_p, List_Chunk_Find_Fnc chunk_fnc, size_t chunk_size, void* ctx_p) //safe
 {
-	if (NULL != iter_p)
+	bool found = false;
+	if (NULL == list_p || NULL == chunk_fnc)
 	{
-		List_Iterator_p new_iter_p = calloc(1, sizeof(List_Iterator_t));
-		memcpy(new_iter_p, iter_p, sizeof(List_Iterator_t));
-		return new_iter_p;
+		return false;
 	}
-	return NULL;
+	List_Walk_Chunks(list_p, chunk_size, NULL, chunk_fnc, ctx_p, &found);
+	return found;
 }
+
+//elements each aggregate kernel works on side by side, one AVX2 register of 32 bit values
+#define LIST_NUM_LANES 8
+//bytes of elements gathered at a time from lists whose elements are not contiguous
+#define LIST_NUM_BLOCK_BYTES 2048
+//most elements handed to a kernel at once, keeping its 32 bit lane counters from overflowing
+#define LIST_NUM_RUN_MAX ((size_t)1 << 24)
+
+//build each aggregate kernel for AVX2 as well as the baseline, picking one when the program loads
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define LIST_NUM_CLONES __attribute__((target_clones("avx2", "default")))
+#else
+#define LIST_NUM_CLONES
+#endif
+
 /*
- *  @brief 					- Proceed to the next item in the list using the given iterator.
- *  @param List_Iterator_p	- A pointer to the iterator who is to proceed to its next list item.
- *  @return List_Iterator_p - A pointer to the data held by the iterator after proceeding to the next item its order or NULL on failure.
- * 								- Although expected, the end of an iteration is considered an 'error' and thus returns NULL when hit.
+ *  @brief An aggregate a kernel can run.
  */
-void* List_Iterator_Next(List_Iterator_p iter_p) 
+typedef enum List_Num_Op
 {
-	void* ret_data = NULL;
-	if (NULL != iter_p && NULL != iter_p->list_p)
-	{
+	LIST_NUM_SUM,
+	LIST_NUM_MIN,
+	LIST_NUM_MAX,
+	LIST_NUM_COUNT, //elements from low to high inclusive
+	LIST_NUM_FIND //first element equal to low
+}
+List_Num_Op;
 
-		pthread_mutex_lock(&(iter_p->list_p->lock));
+/*
+ *  @brief A single value of any List_Num_Type.
+ */
+typedef union List_Num_Value
+{
+	int32_t i32;
+	int64_t i64;
+	float f32;
+	double f64;
+}
+List_Num_Value;
+
+/*
+ *  @brief The state of an aggregate as it runs over the blocks of a list.
+ */
+typedef struct List_Num_Scan
+{
+	List_Num_Op op;
+	List_Num_Value low; //the smallest or largest element so far, the low end of the range or the value to find
+	List_Num_Value high; //the high end of the range
+	uint64_t int_sum; //summed unsigned so overflow wraps rather than being undefined
+	double float_sum;
+	size_t seen; //elements in the blocks before the current one
+	size_t result; //elements counted, or the index of the element found
+}
+List_Num_Scan;
+
+/*
+ *  @brief A kernel running an aggregate over a contiguous block of elements of one type.
+ *  @param const void* The elements.
+ *  @param size_t The number of elements.
+ *  @param List_Num_Scan* The aggregate to run and its state.
+ *  @return bool True once the aggregate is done and no more blocks are needed.
+ */
+typedef bool (*List_Num_Block_Fnc) (const void*, size_t, List_Num_Scan*);
+
+/*
+ *  @brief Define the kernel for elements of type T, named List_Num_Block_name.
+ *	   Every loop keeps LIST_NUM_LANES independent lanes so the compiler can vectorize it,
+ *	   which also means floating point sums are not added up in list order.
+ *  @param name The suffix of the kernel.
+ *  @param T The element type.
+ *  @param field The List_Num_Value member holding a T.
+ *  @param S The type lanes are summed in, uint64_t or double.
+ *  @param sum The List_Num_Scan member the sum is added to.
+ *  @param C The unsigned type lanes are counted in, as wide as T.
+ */
+#define LIST_NUM_BLOCK(name, T, field, S, sum, C) \
+	LIST_NUM_CLONES static bool List_Num_Block_##name(const void* block_p, size_t count, List_Num_Scan* scan_p) \
+	{ \
+		const T* values_p = (const T*)block_p; \
+		size_t i = 0; \
+		switch (scan_p->op) \
+		{ \
+			case LIST_NUM_SUM: \
+			{ \
+				S lanes[LIST_NUM_LANES] = {0}; \
+				for (; i + LIST_NUM_LANES <= count; i += LIST_NUM_LANES) \
+				{ \
+					for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+					{ \
+						lanes[j] += (S)values_p[i + j]; \
+					} \
+				} \
+				for (; i < count; i++) \
+				{ \
+					lanes[0] += (S)values_p[i]; \
+				} \
+				for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+				{ \
+					scan_p->sum += lanes[j]; \
+				} \
+				return false; \
+			} \
+			case LIST_NUM_MIN: \
+			{ \
+				T lanes[LIST_NUM_LANES]; \
+				for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+				{ \
+					lanes[j] = scan_p->low.field; \
+				} \
+				for (; i + LIST_NUM_LANES <= count; i += LIST_NUM_LANES) \
+				{ \
+					for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+					{ \
+						lanes[j] = (values_p[i + j] < lanes[j]) ? values_p[i + j] : lanes[j]; \
+					} \
+				} \
+				for (; i < count; i++) \
+				{ \
+					lanes[0] = (values_p[i] < lanes[0]) ? values_p[i] : lanes[0]; \
+				} \
+				for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+				{ \
+					scan_p->low.field = (lanes[j] < scan_p->low.field) ? lanes[j] : scan_p->low.field; \
+				} \
+				return false; \
+			} \
+			case LIST_NUM_MAX: \
+			{ \
+				T lanes[LIST_NUM_LANES]; \
+				for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+				{ \
+					lanes[j] = scan_p->low.field; \
+				} \
+				for (; i + LIST_NUM_LANES <= count; i += LIST_NUM_LANES) \
+				{ \
+					for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+					{ \
+						lanes[j] = (values_p[i + j] > lanes[j]) ? values_p[i + j] : lanes[j]; \
+					} \
+				} \
+				for (; i < count; i++) \
+				{ \
+					lanes[0] = (values_p[i] > lanes[0]) ? values_p[i] : lanes[0]; \
+				} \
+				for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+				{ \
+					scan_p->low.field = (lanes[j] > scan_p->low.field) ? lanes[j] : scan_p->low.field; \
+				} \
+				return false; \
+			} \
+			case LIST_NUM_COUNT: \
+			{ \
+				const T low = scan_p->low.field; \
+				const T high = scan_p->high.field; \
+				C lanes[LIST_NUM_LANES] = {0}; \
+				for (; i + LIST_NUM_LANES <= count; i += LIST_NUM_LANES) \
+				{ \
+					for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+					{ \
+						lanes[j] += (C)((values_p[i + j] >= low) & (values_p[i + j] <= high)); \
+					} \
+				} \
+				for (; i < count; i++) \
+				{ \
+					lanes[0] += (C)((values_p[i] >= low) & (values_p[i] <= high)); \
+				} \
+				for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+				{ \
+					scan_p->result += lanes[j]; \
+				} \
+				return false; \
+			} \
+			case LIST_NUM_FIND: \
+			{ \
+				const T value = scan_p->low.field; \
+				/* find the first group of lanes holding the value, then the value within it */ \
+				for (; i + LIST_NUM_LANES <= count; i += LIST_NUM_LANES) \
+				{ \
+					C hits = 0; \
+					for (size_t j = 0; j < LIST_NUM_LANES; j++) \
+					{ \
+						hits += (C)(values_p[i + j] == value); \
+					} \
+					if (0 != hits) \
+					{ \
+						break; \
+					} \
+				} \
+				for (; i < count; i++) \
+				{ \
+					if (values_p[i] == value) \
+					{ \
+						scan_p->result = scan_p->seen + i; \
+						return true; \
+					} \
+				} \
+				return false; \
+			} \
+		} \
+		return false; \
+	}
+
+LIST_NUM_BLOCK(Int32, int32_t, i32, uint64_t, int_sum, uint32_t)
+LIST_NUM_BLOCK(Int64, int64_t, i64, uint64_t, int_sum, uint64_t)
+LIST_NUM_BLOCK(Float, float, f32, double, float_sum, uint32_t)
+LIST_NUM_BLOCK(Double, double, f64, double, float_sum, uint64_t)
+
+/*
+ *  @brief Run an aggregate over a sized list of numbers a contiguous block at a time.
+ *	   Ring storage is handed over in place, at most two runs, other storage is gathered into blocks on the stack first.
+ *  @param List_t* The list to run over, its lock must be held.
+ *  @param List_Num_Block_Fnc The kernel for the list's element type.
+ *  @param List_Num_Scan* The aggregate to run and its state.
+ *  @return void.
+ */
+static void List_Num_Walk(List_t* list_p, List_Num_Block_Fnc block_fnc, List_Num_Scan* scan_p) //N/A
+{
+	const size_t elem_size = list_p->elem_size;
+	//only finding cares which element comes first, so only it walks a reversed ring the way it reads
+	if (LIST_STORAGE_RING == list_p->storage && (!list_p->reversed || LIST_NUM_FIND != scan_p->op))
+	{
+		size_t left = list_p->length;
+		size_t slot = list_p->ring_head;
+		while (0 != left)
+		{
+			size_t run = list_p->slot_capacity - slot;
+			if (run > left)
+			{
+				run = left;
+			}
+			if (run > LIST_NUM_RUN_MAX)
+			{
+				run = LIST_NUM_RUN_MAX;
+			}
+			if (block_fnc(LIST_SLOT(list_p, slot), run, scan_p))
+			{
+				return;
+			}
+			scan_p->seen += run;
+			left -= run;
+			slot += run;
+			if (slot == list_p->slot_capacity)
+			{
+				slot = 0;
+			}
+		}
+		return;
+	}
 
-		if (NULL != iter_p->curr_p)
+	_Alignas(64) unsigned char block[LIST_NUM_BLOCK_BYTES];
+	const size_t block_count = LIST_NUM_BLOCK_BYTES / elem_size;
+	size_t count = 0;
+	List_Walk walk;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+		LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk))
+	{
+		//the element size is 4 or 8, copying with a fixed size keeps this from calling memcpy
+		if (4 == elem_size)
 		{
-			iter_p->curr_p = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? iter_p->curr_p->previous_p : iter_p->curr_p->next_p;
+			memcpy(block + 4 * count, List_Pos_Data(current_pos, list_p), 4);
 		}
-		//if this is the first call to next, start the iteration
-		else if (!(iter_p->flags & LIST_ITER_FLAG_FINISHED))
+		else
 		{
-			iter_p->curr_p = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? List_Node_At(iter_p->list_p->length - 1, iter_p->list_p) : List_Node_At(0, iter_p->list_p);
+			memcpy(block + 8 * count, List_Pos_Data(current_pos, list_p), 8);
 		}
-
-		//now that we have updated curr_p, set the return value if possible
-		if (NULL != iter_p->curr_p)
+		if (++count == block_count)
 		{
-			ret_data = iter_p->curr_p->data_p;
+			if (block_fnc(block, count, scan_p))
+			{
+				return;
+			}
+			scan_p->seen += count;
+			count = 0;
 		}
+	}
+	if (0 != count)
+	{
+		block_fnc(block, count, scan_p);
+	}
+}
 
-		//if we are returning NULL this must be the end of the list
-		if (NULL == ret_data)
+/*
+ *  @brief Check the arguments of an aggregate, then run it under the list's lock.
+ *  @param List_t* The list to run over.
+ *  @param List_Num_Type The type of the list's elements, which must match its element size.
+ *  @param List_Num_Scan* The aggregate to run, with low and high set as it needs them. For min and max, low is set from the first element.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT for the min or max of an empty list
+ *	   or any error that may occur.
+ */
+static List_Error_t List_Num_Run(List_t* list_p, List_Num_Type type, List_Num_Scan* scan_p) //N/A
+{
+	static const List_Num_Block_Fnc block_fncs[] = {List_Num_Block_Int32, List_Num_Block_Int64, List_Num_Block_Float, List_Num_Block_Double};
+	static const size_t sizes[] = {sizeof(int32_t), sizeof(int64_t), sizeof(float), sizeof(double)};
+	if (NULL == list_p || (size_t)type >= sizeof(sizes) / sizeof(sizes[0]) || sizes[type] != list_p->elem_size)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+
+	pthread_mutex_lock(&(list_p->lock));
+
+	if (LIST_NUM_MIN == scan_p->op || LIST_NUM_MAX == scan_p->op)
+	{
+		if (0 == list_p->length)
 		{
-			iter_p->flags ^= LIST_ITER_FLAG_FINISHED;
+			ret_val = LIST_ERROR_EXCEED_LIMIT;
+			goto exit;
 		}
-		pthread_mutex_unlock(&(iter_p->list_p->lock));
+		memcpy(&(scan_p->low), List_Pos_Data(List_Pos_First(list_p), list_p), list_p->elem_size);
 	}
-	return ret_data;
+	List_Num_Walk(list_p, block_fncs[type], scan_p);
+
+exit:
+	pthread_mutex_unlock(&(list_p->lock));
+	return ret_val;
 }
+
 /*
- *  @brief 					- Preceed to the previous item in the list using the given iterator.
- *  @param List_Iterator_p 	- A pointer to the iterator who is to preceed to its previous list item.
- *  @return List_Iterator_p - A pointer to the data held by the iterator after preceeding to the previous item in its order.
- * 								- Although expected, the end of an iteration is considered an 'error' and thus returns NULL when hit.
+ *  @brief Sum a sized list of numbers. Integer sums wrap around on overflow.
+ *  @param List_t* The list to sum, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param void* A pointer in which to put the sum, an int64_t for integer types and a double for floating point ones.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-void* List_Iterator_Prev(List_Iterator_p iter_p)
+List_Error_t List_Sum(List_t* list_p, List_Num_Type type, void* sum_p) //safe
 {
-	void* ret_data = NULL;
-	if (NULL != iter_p && NULL != iter_p->list_p) //valid check
-	{ 
-
-		pthread_mutex_lock(&(iter_p->list_p->lock));
-
-		if (NULL != iter_p->curr_p)//normal scenario
-		{
-			iter_p->curr_p = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? iter_p->curr_p->next_p : iter_p->curr_p->previous_p;
-		}
-		//if finished
-		else if (iter_p->flags & LIST_ITER_FLAG_FINISHED)
+	if (NULL == sum_p)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Num_Scan scan = {.op = LIST_NUM_SUM};
+	List_Error_t ret_val = List_Num_Run(list_p, type, &scan);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		if (LIST_NUM_FLOAT == type || LIST_NUM_DOUBLE == type)
 		{
-			iter_p->curr_p = (iter_p->flags & LIST_ITER_FLAG_REVERSE) ? List_Node_At(0, iter_p->list_p) : List_Node_At(iter_p->list_p->length - 1, iter_p->list_p);
-			iter_p->flags ^= LIST_ITER_FLAG_FINISHED;
+			*(double*)sum_p = scan.float_sum;
 		}
-
-		//now that we have updated curr_p, set the return value if possible
-		if (NULL != iter_p->curr_p)
+		else
 		{
-			ret_data = iter_p->curr_p->data_p;
+			*(int64_t*)sum_p = (int64_t)scan.int_sum;
 		}
-		pthread_mutex_unlock(&(iter_p->list_p->lock));
 	}
-	return ret_data;
+	return ret_val;
 }
+
 /*
- *  @brief 					- Get a pointer to the data currently held by the iterator.
- *  @param List_Iterator_p 	- A pointer to the iterator whose list item is to be requested.
- *  @return List_Iterator_p - A pointer to the data held by the iterator after proceeding to the next item in the list or NULL on error.
- * 								- If the iteration has never been started after creation, NULL will be returned.
- * 								- Calling after the iteration finishes will 'step back' to the last item successfully seen
+ *  @brief Find the smallest of a sized list of numbers.
+ *  @param List_t* The list to search, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param void* A pointer in which to put the smallest element, of the element type.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the list is empty or any error that may occur.
  */
-void* List_Iterator_Curr(List_Iterator_p iter_p)
+List_Error_t List_Min(List_t* list_p, List_Num_Type type, void* min_p) //safe
 {
-	if (NULL != iter_p && NULL != iter_p->curr_p)
+	if (NULL == min_p)
 	{
-		return iter_p->curr_p->data_p;
+		return LIST_ERROR_INVALID_PARAM;
 	}
-	return NULL;
+	List_Num_Scan scan = {.op = LIST_NUM_MIN};
+	List_Error_t ret_val = List_Num_Run(list_p, type, &scan);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		memcpy(min_p, &(scan.low), list_p->elem_size);
+	}
+	return ret_val;
 }
+
 /*
- *  @brief 					- Destroy an iterator.
- *  @param List_Iterator_p 	- A pointer to the iterator to be destroyed.
- *  @return void.
+ *  @brief Find the largest of a sized list of numbers.
+ *  @param List_t* The list to search, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param void* A pointer in which to put the largest element, of the element type.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the list is empty or any error that may occur.
  */
-void List_Iterator_Destroy(List_Iterator_p iter_p)
+List_Error_t List_Max(List_t* list_p, List_Num_Type type, void* max_p) //safe
 {
-	if (NULL != iter_p)//not really needed
+	if (NULL == max_p)
 	{
-		free(iter_p);
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	List_Num_Scan scan = {.op = LIST_NUM_MAX};
+	List_Error_t ret_val = List_Num_Run(list_p, type, &scan);
+	if (LIST_ERROR_SUCCESS == ret_val)
+	{
+		memcpy(max_p, &(scan.low), list_p->elem_size);
 	}
+	return ret_val;
 }
 
 /*
- *  @brief Remove the first node from the list.
- *  @param List_t* The list to reduce.
- *  @param list_reduce_fnc The function used to reduce each node.
- *  @param void* The value to begin reduction with.
+ *  @brief Count the elements of a sized list of numbers within an inclusive range.
+ *  @param List_t* The list to count within, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param const void* The lowest value to count, of the element type.
+ *  @param const void* The highest value to count, of the element type.
+ *  @param size_t* A pointer in which to put the count.
  *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
-List_Error_t List_Reduce(List_t* list_p, List_Reduce_Fnc reducer, void* accumulator) //safe
+List_Error_t List_Count_If_Range(List_t* list_p, List_Num_Type type, const void* low_p, const void* high_p, size_t* count_p) //safe
 {
-	//check params
-	if (NULL == list_p || NULL == reducer || NULL == accumulator)
+	if (NULL == list_p || NULL == low_p || NULL == high_p || NULL == count_p)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
-
-	pthread_mutex_lock(&(list_p->lock));
-	
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till we are at the end
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+	List_Num_Scan scan = {.op = LIST_NUM_COUNT};
+	//a wrong element size is caught by List_Num_Run, so only copy what fits
+	size_t value_size = (list_p->elem_size < sizeof(List_Num_Value)) ? list_p->elem_size : sizeof(List_Num_Value);
+	memcpy(&(scan.low), low_p, value_size);
+	memcpy(&(scan.high), high_p, value_size);
+	List_Error_t ret_val = List_Num_Run(list_p, type, &scan);
+	if (LIST_ERROR_SUCCESS == ret_val)
 	{
-		//make sure the node is valid
-		//im not including contingency "else" on purpose
-		if (NULL != current_node)
-		{
-			accumulator = reducer(current_node->data_p, accumulator);
-		}
-		current_node = current_node->next_p;
+		*count_p = scan.result;
 	}
-
-	pthread_mutex_unlock(&(list_p->lock));
-
-	return LIST_ERROR_SUCCESS;
+	return ret_val;
 }
 
 /*
- *  @brief Test each node in a list using a given find function, removing each that fail the given find function.
- *	   Note that filtered entries will be destroyed.
- *  @param List_t* The list to filter entries from.
- *  @param List_Find_Fnc The function to test each entry using.
- *	   A test is passed when this function returns true after being given data.
- *	   A test is failed and filtered out if false is returned.
- *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *  @brief Find the index of the first element of a sized list of numbers equal to a given value.
+ *  @param List_t* The list to search, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param const void* The value to find, of the element type.
+ *  @param size_t* A pointer in which to put the index found.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if no element is equal or any error that may occur.
  */
-List_Error_t List_Filter(List_t* list_p, List_Find_Fnc do_fnc) //safe
+List_Error_t List_Find_Value(List_t* list_p, List_Num_Type type, const void* value_p, size_t* at_p) //safe
 {
-	//check params
-	if (NULL == list_p || NULL == do_fnc)
+	if (NULL == list_p || NULL == value_p || NULL == at_p)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
-	List_Error_t ret_val = LIST_ERROR_SUCCESS;
-
-	pthread_mutex_lock(&(list_p->lock));
-
-	//get the head node, an empty list will give NULL
-	List_Node* current_node = list_p->head_p;
-	//loop till the end (have to use index here)
-	for (size_t i = 0; i < list_p->length && NULL != current_node; i++)
+	List_Num_Scan scan = {.op = LIST_NUM_FIND, .result = SIZE_MAX};
+	size_t value_size = (list_p->elem_size < sizeof(List_Num_Value)) ? list_p->elem_size : sizeof(List_Num_Value);
+	memcpy(&(scan.low), value_p, value_size);
+	List_Error_t ret_val = List_Num_Run(list_p, type, &scan);
+	if (LIST_ERROR_SUCCESS == ret_val)
 	{
-		//make sure the node is valid
-		if (NULL != current_node)
+		if (SIZE_MAX == scan.result)
 		{
-			//check if this node is the right one
-			bool do_result = do_fnc(current_node->data_p);
-			//store next node
-			List_Node* next_node = current_node->next_p;
-			if (!do_result)
-			{
-				//delete node and free its data
-				pthread_mutex_unlock(&(list_p->lock)); //just a cheat, i dont really like this
-				List_Delete_At(i, list_p); //safe call
-				pthread_mutex_lock(&(list_p->lock));
-				i--;
-			}
-			//use next node
-			current_node = next_node;
+			ret_val = LIST_ERROR_EXCEED_LIMIT;
 		}
 		else
 		{
-			//we have hit a dead end
-			ret_val = LIST_ERROR_BAD_ENTRY;
-			goto exit;
+			*at_p = scan.result;
 		}
 	}
-	//we didnt find a match
-exit:
-	pthread_mutex_unlock(&(list_p->lock));
 	return ret_val;
 }
 
+//stages a pipeline can hold
+#define LIST_PIPELINE_MAX_STAGES 16
+
 /*
- *  @brief Remove and destroy every node in the given list.
- *  @param List_t* The list to destroy nodes within.
- *  @return void.
+ *  @brief What a pipeline stage does to the values reaching it.
  */
-void List_Purge(List_t* list_p) //safe
+typedef enum List_Stage_Kind
 {
-	//check params
-	if (NULL == list_p)
-	{
-		return;
-	}
-	//delete all list members until length is 0
-	while (list_p->length)
-	{
-		List_Delete_At(0, list_p); //safe call
-	}
-	return;
+	LIST_STAGE_MAP,
+	LIST_STAGE_FILTER,
+	LIST_STAGE_TAKE
 }
+List_Stage_Kind;
 
 /*
- *  @brief Destroy the given list and every node within it.
- *  @param List_t* The list to destroy.
- *  @return void.
+ *  @brief A single stage of a pipeline.
  */
-void List_Destroy(List_t* list_p) //safe
+typedef struct List_Stage
 {
-	//check params
-	if (NULL == list_p)
+	List_Stage_Kind kind;
+	List_Copy_Fnc map_fnc; //map only
+	List_Free_Fnc free_fnc; //map only, frees what map_fnc gave back, may be NULL
+	List_Find_Fnc keep_fnc; //filter only
+	size_t limit; //take only
+}
+List_Stage;
+
+/*
+ *  @brief A pipeline, the list it reads and its stages in order.
+ */
+struct List_Pipeline_t
+{
+	List_t* list_p;
+	size_t stage_count;
+	List_Stage stages[LIST_PIPELINE_MAX_STAGES];
+};
+
+/*
+ *  @brief Start a pipeline over a list. Nothing is done to the list until the pipeline is reduced or collected.
+ *  @param List_t* The list the pipeline reads, which must outlive the pipeline.
+ *  @return List_Pipeline_p A pointer to an allocated pipeline with no stages or NULL on error.
+ */
+List_Pipeline_p List_Pipeline_Create(List_t* list_p) //safe
+{
+	List_Pipeline_p pipeline_p = NULL;
+	if (NULL != list_p)
 	{
-		return;
+		pipeline_p = calloc(1, sizeof(List_Pipeline_t));
+		if (NULL != pipeline_p)
+		{
+			pipeline_p->list_p = list_p;
+			pipeline_p->stage_count = 0;
+		}
 	}
-	List_Purge(list_p); //safe call
-	//all has been freed
-	pthread_mutex_destroy(&(list_p->lock));
-	free(list_p);//setting to null here does nothing
-	return;
+	return pipeline_p;
 }
 
 /*
- *  @brief Get the current length of a given list.
- *  @param List_t* The list in question.
- *  @return size_t the length of the list
- * 	   Not ethat 0 will be returned if the list does not exist.
+ *  @brief Add a stage to the end of a pipeline.
+ *  @param List_Pipeline_p The pipeline to add to.
+ *  @param List_Stage The stage to add.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the pipeline has no room left.
  */
-size_t List_Length(List_t* list_p) //safe
+static List_Error_t List_Pipeline_Add(List_Pipeline_p pipeline_p, List_Stage stage) //N/A
 {
-	if (NULL != list_p)
+	if (LIST_PIPELINE_MAX_STAGES == pipeline_p->stage_count)
 	{
-		return list_p->length;
+		return LIST_ERROR_EXCEED_LIMIT;
 	}
-	return 0;
+	pipeline_p->stages[pipeline_p->stage_count++] = stage;
+	return LIST_ERROR_SUCCESS;
 }
 
 /*
- *  @brief Reverse a given list from its current order.
- *  @param List_t* The list to reverse.
- *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *  @brief Add a stage replacing each value with the result of a function, like List_Copy does.
+ *  @param List_Pipeline_p The pipeline to add to.
+ *  @param List_Copy_Fnc The function giving the new value, NULL from it stops the pipeline with LIST_ERROR_BAD_ENTRY.
+ *  @param List_Free_Fnc The function freeing a new value once no later stage needs it, or NULL if they need no freeing.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the pipeline has no room left or any error that may occur.
  */
-List_Error_t List_Reverse(List_t* list_p)
+List_Error_t List_Pipeline_Map(List_Pipeline_p pipeline_p, List_Copy_Fnc map_fnc, List_Free_Fnc free_fnc) //N/A
 {
-	if (NULL == list_p)
+	if (NULL == pipeline_p || NULL == map_fnc)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
-	List_Error_t ret_val = LIST_ERROR_SUCCESS;
-
-	pthread_mutex_lock(&(list_p->lock));
+	List_Stage stage = {.kind = LIST_STAGE_MAP, .map_fnc = map_fnc, .free_fnc = free_fnc};
+	return List_Pipeline_Add(pipeline_p, stage);
+}
 
-	size_t midpoint = list_p->length / 2;
-	List_Node* front_node = list_p->head_p;
-	List_Node* rear_node = List_Node_At(list_p->length-1, list_p);
-	for(size_t i = 0; i < midpoint; i++)
+/*
+ *  @brief Add a stage only passing on the values a function returns true for.
+ *  @param List_Pipeline_p The pipeline to add to.
+ *  @param List_Find_Fnc The function testing each value.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the pipeline has no room left or any error that may occur.
+ */
+List_Error_t List_Pipeline_Filter(List_Pipeline_p pipeline_p, List_Find_Fnc keep_fnc) //N/A
+{
+	if (NULL == pipeline_p || NULL == keep_fnc)
 	{
-		List_Error_t could_swap = List_Node_Swap(front_node, rear_node);
-		if (LIST_ERROR_SUCCESS != could_swap)
-		{
-			ret_val = could_swap;
-			goto exit;
-		}
-
-		front_node = front_node->next_p;
-		rear_node = rear_node->previous_p;
+		return LIST_ERROR_INVALID_PARAM;
 	}
-
-exit:
-	pthread_mutex_unlock(&(list_p->lock));
-	return ret_val;
+	List_Stage stage = {.kind = LIST_STAGE_FILTER, .keep_fnc = keep_fnc};
+	return List_Pipeline_Add(pipeline_p, stage);
 }
 
 /*
- *  @brief Sort a given list using the set comparison function.
- *	   A list is considered sorted when precedence is in oredr from high to low
- *  @param List_t* The list to sort.
- *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use during sorting.
-						If NULL is used here, the list's default cmp function will be used
- *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ *  @brief Add a stage passing on only the first values to reach it. The walk over the list stops once it has passed them all.
+ *  @param List_Pipeline_p The pipeline to add to.
+ *  @param size_t The number of values to pass on.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the pipeline has no room left or any error that may occur.
  */
-List_Error_t List_Sort(List_t* list_p, List_Cmp_Fnc cmp_fnc)
+List_Error_t List_Pipeline_Take(List_Pipeline_p pipeline_p, size_t count) //N/A
 {
-	if (NULL == list_p)
+	if (NULL == pipeline_p)
 	{
 		return LIST_ERROR_INVALID_PARAM;
 	}
+	List_Stage stage = {.kind = LIST_STAGE_TAKE, .limit = count};
+	return List_Pipeline_Add(pipeline_p, stage);
+}
+
+/*
+ *  @brief Run every value of a list through the stages of a pipeline in a single walk under the list's lock,
+ *	   handing each value that makes it through to a reducer or pushing it onto a list.
+ *	   A mapped value is freed as soon as a later map replaces it, a filter drops it or the reducer is done with it.
+ *  @param List_Pipeline_p The pipeline to run.
+ *  @param List_Reduce_Fnc The function used to reduce each value, or NULL to push them onto out_p instead.
+ *  @param void* The value to begin reduction with.
+ *  @param List_t* The list to push values onto when there is no reducer.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_BAD_ENTRY if a map stage gave back NULL or any error that may occur.
+ */
+static List_Error_t List_Pipeline_Run(List_Pipeline_p pipeline_p, List_Reduce_Fnc reducer, void* accumulator, List_t* out_p) //N/A
+{
+	List_t* list_p = pipeline_p->list_p;
 	List_Error_t ret_val = LIST_ERROR_SUCCESS;
+	size_t taken[LIST_PIPELINE_MAX_STAGES] = {0};
+	bool done = false;
+
+	//a take of nothing is done before it starts
+	for (size_t s = 0; s < pipeline_p->stage_count; s++)
+	{
+		done = done || (LIST_STAGE_TAKE == pipeline_p->stages[s].kind && 0 == pipeline_p->stages[s].limit);
+	}
 
 	pthread_mutex_lock(&(list_p->lock));
-	while(!List_Is_Sorted(list_p, cmp_fnc))
+
+	List_Walk walk;
+	for (List_Pos current_pos = List_Walk_Begin(&walk, list_p, List_Pos_First(list_p), list_p->length);
+		!done && LIST_POS_NONE != current_pos; current_pos = List_Walk_Next(&walk))
 	{
-		//loop through every node until the second to last one
-		for(size_t i = 0; i < list_p->length-1; i++)
+		void* value_p = List_Pos_Data(current_pos, list_p);
+		//frees value_p once it is no longer needed, NULL while it belongs to the list
+		List_Free_Fnc owner_free = NULL;
+		bool kept = true;
+		for (size_t s = 0; kept && s < pipeline_p->stage_count; s++)
 		{
-			//compare current and next node
-			List_Node* current_node = List_Node_At(i, list_p);
-			if (NULL == current_node)
+			List_Stage* stage_p = &(pipeline_p->stages[s]);
+			if (LIST_STAGE_MAP == stage_p->kind)
 			{
-				ret_val = LIST_ERROR_BAD_ENTRY;
-				goto exit;
+				void* mapped_p = stage_p->map_fnc(value_p);
+				if (NULL != owner_free)
+				{
+					owner_free(value_p);
+				}
+				value_p = mapped_p;
+				owner_free = stage_p->free_fnc;
+				if (NULL == value_p)
+				{
+					ret_val = LIST_ERROR_BAD_ENTRY;
+					goto exit;
+				}
+			}
+			else if (LIST_STAGE_FILTER == stage_p->kind)
+			{
+				kept = stage_p->keep_fnc(value_p);
 			}
-			int node_cmp = 0;
-			if (NULL == cmp_fnc && NULL != list_p->cmp)
+			else
+			{
+				//no value can make it past a take that is full, so stop walking once this one is through
+				taken[s]++;
+				done = done || (taken[s] == stage_p->limit);
+			}
+		}
+		if (!kept)
+		{
+			if (NULL != owner_free)
 			{
-				node_cmp = list_p->cmp(
-					current_node->data_p,
-					current_node->next_p->data_p
-				);
+				owner_free(value_p);
 			}
-			else if (NULL != cmp_fnc)
+			continue;
+		}
+		if (NULL != reducer)
+		{
+			accumulator = reducer(value_p, accumulator);
+			if (NULL != owner_free)
 			{
-				node_cmp = cmp_fnc(
-					current_node->data_p,
-					current_node->next_p->data_p
-				);
+				owner_free(value_p);
 			}
-			if (0 > node_cmp)
+		}
+		else
+		{
+			//the new list owns mapped values from here on
+			ret_val = List_Push(value_p, out_p);
+			if (LIST_ERROR_SUCCESS != ret_val)
 			{
-				List_Error_t could_swap = List_Node_Swap(
-					List_Node_At(i, list_p),
-					List_Node_At(i+1, list_p)
-				);
-				if (LIST_ERROR_SUCCESS != could_swap)
+				if (NULL != owner_free)
 				{
-					ret_val = could_swap;
-					goto exit;
+					owner_free(value_p);
 				}
+				goto exit;
 			}
 		}
 	}
@@ -1221,3 +6043,76 @@ exit:
 	pthread_mutex_unlock(&(list_p->lock));
 	return ret_val;
 }
+
+/*
+ *  @brief Run a pipeline, reducing every value that makes it through all the stages.
+ *  @param List_Pipeline_p The pipeline to run.
+ *  @param List_Reduce_Fnc The function used to reduce each value.
+ *  @param void* The value to begin reduction with.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Pipeline_Reduce(List_Pipeline_p pipeline_p, List_Reduce_Fnc reducer, void* accumulator) //safe
+{
+	if (NULL == pipeline_p || NULL == reducer || NULL == accumulator)
+	{
+		return LIST_ERROR_INVALID_PARAM;
+	}
+	return List_Pipeline_Run(pipeline_p, reducer, accumulator, NULL);
+}
+
+/*
+ *  @brief Run a pipeline, collecting every value that makes it through all the stages into a new list.
+ *	   Without a map stage the new list is set up like the one read and holds the same values, as List_Copy would without a copy function.
+ *	   With one it holds caller pointers to the mapped values and frees them with the free function of the last map stage.
+ *  @param List_Pipeline_p The pipeline to run.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Pipeline_Collect(List_Pipeline_p pipeline_p) //safe
+{
+	if (NULL == pipeline_p)
+	{
+		return NULL;
+	}
+	List_Stage* last_map_p = NULL;
+	for (size_t s = 0; s < pipeline_p->stage_count; s++)
+	{
+		if (LIST_STAGE_MAP == pipeline_p->stages[s].kind)
+		{
+			last_map_p = &(pipeline_p->stages[s]);
+		}
+	}
+
+	List_t* out_p = NULL;
+	if (NULL == last_map_p)
+	{
+		pthread_mutex_lock(&(pipeline_p->list_p->lock));
+		out_p = List_Create_Like(pipeline_p->list_p);
+		pthread_mutex_unlock(&(pipeline_p->list_p->lock));
+	}
+	else
+	{
+		//the last map's values may need no freeing
+		out_p = List_Alloc(0, NULL, last_map_p->free_fnc, 0, LIST_STORAGE_NODES);
+	}
+	if (NULL == out_p)
+	{
+		return NULL;
+	}
+
+	if (LIST_ERROR_SUCCESS != List_Pipeline_Run(pipeline_p, NULL, NULL, out_p))
+	{
+		List_Destroy(out_p);
+		return NULL;
+	}
+	return out_p;
+}
+
+/*
+ *  @brief Free a pipeline. The list it reads is left alone.
+ *  @param List_Pipeline_p The pipeline to free.
+ *  @return void.
+ */
+void List_Pipeline_Destroy(List_Pipeline_p pipeline_p) //safe
+{
+	free(pipeline_p);
+}
@@ -9,6 +9,7 @@
 #include <string.h> //memcpy
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <pthread.h>
 
 /*
@@ -23,6 +24,17 @@ typedef enum List_Error_t {
 }
 List_Error_t;
 
+/*
+ *  @brief The numeric types a sized list can hold for the built in aggregates such as List_Sum.
+ */
+typedef enum List_Num_Type {
+	LIST_NUM_INT32, //int32_t elements, summed into an int64_t
+	LIST_NUM_INT64, //int64_t elements, summed into an int64_t
+	LIST_NUM_FLOAT, //float elements, summed into a double
+	LIST_NUM_DOUBLE //double elements, summed into a double
+}
+List_Num_Type;
+
 /*
  *  @brief A function used to compare data within a list.
  *  @param void* The first data to compare.
@@ -62,6 +74,28 @@ typedef void* (*List_Reduce_Fnc) (const void*, void*);
  *  @return void* A pointer to the newly copied data.
  */
 typedef void* (*List_Copy_Fnc) (const void*);
+/*
+ *  @brief A function used to get an integer sort key from data within a list.
+ *  @param void* The data to get the key of. This should not be altered
+ *  @return uint64_t The key, higher keys having more precedence.
+ */
+typedef uint64_t (*List_Key_Fnc) (const void*);
+/*
+ *  @brief A function used to perform an action on a chunk of data within a list at once.
+ *  @param void** The data pointers of the chunk, in list order.
+ *  @param size_t The number of data pointers in the chunk.
+ *  @param void* The context pointer given by the caller.
+ *  @return void.
+ */
+typedef void (*List_Chunk_Fnc) (void**, size_t, void*);
+/*
+ *  @brief A function used to perform a boolean test on a chunk of data within a list at once.
+ *  @param void** The data pointers of the chunk, in list order.
+ *  @param size_t The number of data pointers in the chunk.
+ *  @param void* The context pointer given by the caller.
+ *  @return bool True should indicate something in the chunk passed the test.
+ */
+typedef bool (*List_Chunk_Find_Fnc) (void**, size_t, void*);
 
 /*
  *  @brief The list itself.
@@ -71,6 +105,42 @@ typedef struct List_t List_t, *List_p;
  *  @brief A list iterator.
  */
 typedef struct List_Iterator_t List_Iterator_t, *List_Iterator_p;
+/*
+ *  @brief A lazy chain of map, filter and take stages over a list, run in a single pass by a reduce or collect.
+ */
+typedef struct List_Pipeline_t List_Pipeline_t, *List_Pipeline_p;
+/*
+ *  @brief Caller storage big enough for any iterator, so one can live on the stack or inside another structure.
+ *	   It holds no pointers into itself, so an iterator in it can be copied by copying the storage.
+ */
+typedef union List_Iterator_Storage
+{
+	void* align_p;
+	uint64_t align_u;
+	unsigned char bytes[4 * sizeof(void*)];
+}
+List_Iterator_Storage;
+/*
+ *  @brief The leading fields of every node of a node storage list, shared so LIST_FOREACH can follow them inline.
+ */
+typedef struct List_Node_Head List_Node_Head;
+struct List_Node_Head
+{
+	void* data_p;
+	List_Node_Head* next_p;
+};
+/*
+ *  @brief The state of a LIST_FOREACH walk.
+ */
+typedef struct List_Foreach_t
+{
+	List_t* list_p;
+	List_Node_Head* node_p; //next node of a node storage list
+	uintptr_t pos; //next position of any other list
+	bool nodes; //whether node_p is followed or pos is stepped
+	bool active; //whether the list is locked
+}
+List_Foreach_t;
 
 /*
  *  @brief Create an empty list.
@@ -82,6 +152,112 @@ typedef struct List_Iterator_t List_Iterator_t, *List_Iterator_p;
  */
 List_t* List_Create(size_t, List_Cmp_Fnc, List_Free_Fnc);
 
+/*
+ *  @brief Create an empty list that stores fixed size elements inline in its nodes.
+ *	   Inserting copies the element into the node and accessors hand back pointers to that copy,
+ *	   so each element costs a single allocation and no free function is ever called on them.
+ *	   Use List_Remove_At_Into, List_Pop_Into and List_Shift_Into to take elements out of these lists,
+ *	   List_Remove_At, List_Pop and List_Shift will always give NULL.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp);
+
+/*
+ *  @brief Create an empty list that keeps its elements in one growable array linked by 32 bit indices.
+ *	   Each element costs 16 bytes on 64 bit targets instead of a separately allocated node.
+ *	   Every other List_* function works on these lists just the same.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum other than the 2^32 - 1 slots indices can name.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Compact(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free);
+
+/*
+ *  @brief Create an empty list that keeps fixed size elements inline in one growable array linked by 32 bit indices.
+ *	   Each element costs its own size plus 8 bytes of links, rounded up to the element's alignment.
+ *	   Pointers to elements are only good until the array next has to grow or the list is compacted.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum other than the 2^32 - 1 slots indices can name.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Compact_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp);
+
+/*
+ *  @brief Create an empty list that keeps its elements in one growable circular array, in list order.
+ *	   Pushing or removing at either end and indexing are all O(1), inserting or removing elsewhere
+ *	   moves the elements on the shorter side of the index.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum. The array never grows past it.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Deque(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free);
+
+/*
+ *  @brief Create an empty list that keeps fixed size elements inline in one growable circular array, in list order.
+ *	   Pointers to elements are only good until the list is next changed.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum. The array never grows past it.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Deque_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp);
+
+/*
+ *  @brief Create an empty priority queue, a list kept as a binary heap so that its first element always has the most precedence.
+ *	   List_Push, List_Insert, List_Shift and List_Pop_Max are O(log n), List_Peek_Max is O(1).
+ *	   Indices given to inserts are only checked, never honored, and the rest of the list is in no useful order.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list, required.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Heap(size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free);
+
+/*
+ *  @brief Create an empty priority queue of fixed size elements stored inline.
+ *	   Pointers to elements are only good until the list is next changed.
+ *  @param size_t The size in bytes of every element.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list, required.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Create_Heap_Sized(size_t elem_size, size_t max_length, List_Cmp_Fnc cmp);
+
+/*
+ *  @brief Get the number of bytes a buffer needs to hold a list made with List_Init_In_Buffer.
+ *  @param size_t The number of elements the list should be able to hold.
+ *  @return size_t The size in bytes, which allows for a buffer of any alignment, or 0 if it cant be represented.
+ */
+size_t List_Buffer_Size(size_t max_length);
+
+/*
+ *  @brief Set up an empty list inside a caller provided buffer, such as a static or stack array, along with a node
+ *	   for every element it may hold. Nothing is ever allocated for the list afterwards: inserts take nodes from a
+ *	   free list kept in the buffer and fail with LIST_ERROR_EXCEED_LIMIT once max_length is reached.
+ *	   Nodes never leave the buffer: List_Concat, List_Splice, List_Split and List_Transfer copy elements into or out
+ *	   of a buffer list, so moving elements out only allocates what the other list needs to hold them.
+ *  @param void* The buffer to put the list in, which must outlive the list.
+ *  @param size_t The size of the buffer in bytes, at least List_Buffer_Size(max_length).
+ *  @param size_t The number of elements the list can hold, must be at least 1.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *	   Passing NULL here will cause each member to have the same precedence.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the list, somewhere within the buffer, or NULL on error.
+ *	   List_Destroy releases the elements but leaves the buffer to the caller.
+ */
+List_t* List_Init_In_Buffer(void* buf_p, size_t bytes, size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free);
+
 /*
  *  @brief Copy that the given list is valid.
  *  @param List_t* The list to copy.
@@ -93,6 +269,59 @@ List_t* List_Create(size_t, List_Cmp_Fnc, List_Free_Fnc);
  */
 List_t* List_Copy(List_t* list_p, List_Copy_Fnc copy_node);
 
+/*
+ *  @brief Copy a list, spreading calls to the copy function over several threads.
+ *	   Meant for expensive deep copies, the copy function must be safe to call from multiple threads.
+ *	   Just like List_Copy, every node of the copy is allocated in a single block.
+ *  @param List_t* The list to copy.
+ *  @param List_Copy_Fnc A user provided function to copy node values.
+			If Null is passed, a shallow copy will be formed just like List_Copy.
+ *  @param size_t The number of threads to use including the caller, 0 picks one per online cpu.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Copy_Parallel(List_t* list_p, List_Copy_Fnc copy_node, size_t thread_count);
+/*
+ *  @brief Map every value of a list into a new list of the same length, in the same order.
+ *	   The new list holds caller pointers and has every node allocated in a single block.
+ *  @param List_t* The list to map, which may hold caller pointers or inline elements.
+ *  @param List_Copy_Fnc The function giving the new value for each one. If it ever gives back NULL the whole map fails.
+ *  @param List_Free_Fnc The function the new list frees its values with.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Map(List_t* list_p, List_Copy_Fnc map_fnc, List_Free_Fnc free_fnc);
+/*
+ *  @brief Map every value of a list into a new list, spreading calls to the map function over several threads.
+ *	   Meant for expensive mappings, the map function must be safe to call from multiple threads.
+ *  @param List_t* The list to map, which may hold caller pointers or inline elements.
+ *  @param List_Copy_Fnc The function giving the new value for each one. If it ever gives back NULL the whole map fails.
+ *  @param List_Free_Fnc The function the new list frees its values with.
+ *  @param size_t The number of threads to use including the caller, 0 picks one per online cpu.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Map_Parallel(List_t* list_p, List_Copy_Fnc map_fnc, List_Free_Fnc free_fnc, size_t thread_count);
+/*
+ *  @brief Clone a list in O(1), the clone sharing the list's storage until either of them writes to it.
+ *	   Whichever list writes first copies the whole storage for itself, so clones only read from cost nothing.
+ *	   Like List_Copy with no copy function, the clone holds the same caller pointers as the list. The clone has no free function,
+ *	   so the list cloned from goes on owning and freeing them, and the clone must not be read after the list frees them.
+ *	   Values put into a clone, or moved out of it into another list, are never freed by the clone either.
+ *	   Pointers into the inline elements of a shared sized list, from List_At, iterators or LIST_FOREACH,
+ *	   must only be read through unless List_Own_Storage is called first, functions that write (List_For_Each,
+ *	   List_To_Array, ...) take a copy first.
+ *	   The first clone of a list moves any nodes it keeps in the list itself, so like List_Compact it invalidates iterators.
+ *  @param List_t* The list to clone.
+ *  @return List_t* A pointer to the clone or NULL on error.
+ */
+List_t* List_Clone_COW(List_t* list_p);
+/*
+ *  @brief Give a list storage of its own, copying whatever it still shares with copy on write clones.
+ *	   Afterwards the inline elements of a sized list can be written through pointers from List_At or iterators,
+ *	   until the list is next cloned. Lists sharing nothing are left as they are.
+ *  @param List_t* The list to give its own storage.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur, in which case the list still shares.
+ */
+List_Error_t List_Own_Storage(List_t* list_p);
+
 /*
  *  @brief Verify that the given list is valid.
  *  @param List_t* The list to verify.
@@ -176,6 +405,24 @@ bool List_Every(List_t*, List_Find_Fnc);
  *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
 List_Error_t List_For_Each(List_t*, List_Do_Fnc);
+/*
+ *  @brief Perform a function on the data of a list a chunk at a time, so the function can loop over plain arrays.
+ *  @param List_t* The list to perform the function on.
+ *  @param List_Chunk_Fnc The function, given an array of data pointers in list order, their count and the context pointer.
+ *  @param size_t The most data pointers handed over at once, 0 for a default of 64. Only the last chunk may be smaller.
+ *  @param void* A context pointer handed to every call, such as an accumulator.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_For_Each_Chunk(List_t* list_p, List_Chunk_Fnc chunk_fnc, size_t chunk_size, void* ctx_p);
+/*
+ *  @brief Check the data of a list a chunk at a time, stopping at the first chunk the function returns true for.
+ *  @param List_t* The list to check.
+ *  @param List_Chunk_Find_Fnc The function, given an array of data pointers in list order, their count and the context pointer.
+ *  @param size_t The most data pointers handed over at once, 0 for a default of 64. Only the last chunk may be smaller.
+ *  @param void* A context pointer handed to every call, such as where to record which element matched.
+ *  @return bool True if the function returned true for any chunk, false otherwise or on error.
+ */
+bool List_Some_Chunk(List_t* list_p, List_Chunk_Find_Fnc chunk_fnc, size_t chunk_size, void* ctx_p);
 /*
  *  @brief Find the first instance of a given search data using the defined compare function.
  *  @param void* The data to use as a 'search term'.
@@ -219,6 +466,79 @@ void* List_Pop(List_t*);
  */
 void* List_Shift(List_t*);
 
+/*
+ *  @brief Remove a given index from the list, copying its element out.
+ *	   This is how elements are taken out of sized lists, where the element lives inside the node.
+ *  @param size_t The index to remove from the list.
+ *  @param List_t* The list to remove the given index from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise.
+ *	   May be NULL to just drop the node without freeing anything.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Remove_At_Into(size_t at, List_t* list_p, void* out_p);
+/*
+ *  @brief Remove the last node from the list, copying its element out.
+ *  @param List_t* The list to remove the last node from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise. May be NULL.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Pop_Into(List_t* list_p, void* out_p);
+/*
+ *  @brief Remove the first node from the list, copying its element out.
+ *  @param List_t* The list to remove the first node from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise. May be NULL.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Shift_Into(List_t* list_p, void* out_p);
+
+/*
+ *  @brief Get the data with the most precedence in a list without removing it.
+ *	   This is O(1) for lists made with List_Create_Heap and a scan for any other list.
+ *  @param List_t* The list in question.
+ *  @return void* The data, a pointer to the inline element for sized lists, or NULL on error.
+ */
+void* List_Peek_Max(List_t* list_p);
+/*
+ *  @brief Remove the data with the most precedence from a list.
+ *	   This is O(log n) for lists made with List_Create_Heap and a scan for any other list.
+ *  @param List_t* The list to remove from, sized lists need List_Pop_Max_Into.
+ *  @return void* The data that was removed or NULL on error.
+ */
+void* List_Pop_Max(List_t* list_p);
+/*
+ *  @brief Remove the data with the most precedence from a list, copying it out.
+ *  @param List_t* The list to remove from.
+ *  @param void* Where to copy the element to, elem_size bytes for sized lists or a void* otherwise.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Pop_Max_Into(List_t* list_p, void* out_p);
+/*
+ *  @brief Empty a heap into a new list sorted from most to least precedence, heapsorting the elements in place.
+ *	   The new list is a deque that takes over the heap's array, so the only allocation is the list itself.
+ *  @param List_t* A list made with List_Create_Heap or List_Create_Heap_Sized, left empty but still valid.
+ *  @return List_t* A pointer to the sorted list or NULL on error, in which case the heap is untouched.
+ */
+List_t* List_Heap_Drain(List_t* list_p);
+/*
+ *  @brief Add the k elements with the most precedence in a list to the end of another list, most precedence first,
+ *	   without sorting or reordering the list itself. Runs in O(n log k).
+ *  @param List_t* The list to select from.
+ *  @param size_t The number of elements to take, all of them if the list is shorter.
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use, NULL for the list's own.
+ *  @param List_t* The list to add the elements to, which must have the same element size.
+ *	   The data is shared with the list it came from, so a list of pointers should not free it too.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur, in which case nothing is added.
+ */
+List_Error_t List_Top_K(List_t* list_p, size_t k, List_Cmp_Fnc cmp_fnc, List_t* out_p);
+/*
+ *  @brief Get the element that would be at a given index were the list sorted, without sorting or reordering it.
+ *  @param List_t* The list in question.
+ *  @param size_t The index in sorted order, 0 being the element with the most precedence.
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use, NULL for the list's own.
+ *  @return void* The data, a pointer to the inline element for sized lists, or NULL on error.
+ */
+void* List_Nth_Element(List_t* list_p, size_t n, List_Cmp_Fnc cmp_fnc);
+
 /*
  *  @brief 					- Create an iterator for in-order procession through items in the given list.
  *  @param List_p 			- A pointer to the list to create an iterator for.
@@ -237,6 +557,14 @@ List_Iterator_p List_Iterator_Create_Reverse(List_p);
  *  @return List_Iterator_p - A pointer to a copied list iterator or NULL on failure.
  */
 List_Iterator_p List_Iterator_Copy(List_Iterator_p);
+/*
+ *  @brief 					- Set up an iterator in caller storage, which needs no allocation and no List_Iterator_Destroy.
+ *  @param List_Iterator_Storage* - The storage to use, which must outlive the iterator.
+ *  @param List_p 			- A pointer to the list to iterate over.
+ *  @param bool 			- True for reversed-order procession, false for in-order.
+ *  @return List_Iterator_p - The storage as an iterator or NULL on failure.
+ */
+List_Iterator_p List_Iterator_Init(List_Iterator_Storage* storage_p, List_p list_p, bool reverse);
 /*
  *  @brief 					- Proceed to the next item in the list using the given iterator.
  *  @param List_Iterator_p	- A pointer to the iterator who is to proceed to its next list item.
@@ -266,6 +594,52 @@ void* List_Iterator_Curr(List_Iterator_p);
  */
 void List_Iterator_Destroy(List_Iterator_p);
 
+/*
+ *  @brief Lock a list and start walking it in order, for LIST_FOREACH.
+ *  @param List_t* The list to walk, NULL for nothing to walk.
+ *  @return List_Foreach_t The state of the walk, which must be handed to List_Foreach_End when it is active.
+ */
+List_Foreach_t List_Foreach_Begin(List_t* list_p);
+/*
+ *  @brief Step a walk over a list that isnt made of nodes, which List_Foreach_Next cant follow inline.
+ *  @param List_Foreach_t* The state of the walk, whose list is locked.
+ *  @return void* The data of the next element or NULL at the end.
+ */
+void* List_Foreach_Step(List_Foreach_t* foreach_p);
+/*
+ *  @brief Finish walking a list, unlocking it.
+ *  @param List_Foreach_t* The state of the walk.
+ *  @return void.
+ */
+void List_Foreach_End(List_Foreach_t* foreach_p);
+/*
+ *  @brief Step a LIST_FOREACH walk, following node storage lists inline.
+ *  @param List_Foreach_t* The state of the walk, whose list is locked.
+ *  @return void* The data of the next element or NULL at the end.
+ */
+static inline void* List_Foreach_Next(List_Foreach_t* foreach_p)
+{
+	if (!foreach_p->nodes)
+	{
+		return List_Foreach_Step(foreach_p);
+	}
+	List_Node_Head* node_p = foreach_p->node_p;
+	if (NULL == node_p)
+	{
+		return NULL;
+	}
+	foreach_p->node_p = node_p->next_p;
+	return node_p->data_p;
+}
+/*
+ *  @brief Walk every element of a list in order with the list locked, declaring var as a void* to each one's data.
+ *	   The outer loop unlocks the list however the inner one ends, so break is fine but return and goto are not.
+ *	   The body must not call anything else that locks the same list.
+ */
+#define LIST_FOREACH(list_p, var) \
+	for (List_Foreach_t list_foreach_##var = List_Foreach_Begin(list_p); list_foreach_##var.active; List_Foreach_End(&list_foreach_##var)) \
+		for (void* var = List_Foreach_Next(&list_foreach_##var); NULL != var; var = List_Foreach_Next(&list_foreach_##var))
+
 /*
  *  @brief Remove the first node from the list.
  *  @param List_t* The list to reduce.
@@ -274,6 +648,49 @@ void List_Iterator_Destroy(List_Iterator_p);
  *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
 List_Error_t List_Reduce(List_t* list_p, List_Reduce_Fnc reducer, void* accumulator);
+/*
+ *  @brief Sum a sized list of numbers. Integer sums wrap around on overflow.
+ *  @param List_t* The list to sum, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param void* A pointer in which to put the sum, an int64_t for integer types and a double for floating point ones.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Sum(List_t* list_p, List_Num_Type type, void* sum_p);
+/*
+ *  @brief Find the smallest of a sized list of numbers.
+ *  @param List_t* The list to search, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param void* A pointer in which to put the smallest element, of the element type.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the list is empty or any error that may occur.
+ */
+List_Error_t List_Min(List_t* list_p, List_Num_Type type, void* min_p);
+/*
+ *  @brief Find the largest of a sized list of numbers.
+ *  @param List_t* The list to search, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param void* A pointer in which to put the largest element, of the element type.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the list is empty or any error that may occur.
+ */
+List_Error_t List_Max(List_t* list_p, List_Num_Type type, void* max_p);
+/*
+ *  @brief Count the elements of a sized list of numbers within an inclusive range.
+ *  @param List_t* The list to count within, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param const void* The lowest value to count, of the element type.
+ *  @param const void* The highest value to count, of the element type.
+ *  @param size_t* A pointer in which to put the count.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Count_If_Range(List_t* list_p, List_Num_Type type, const void* low_p, const void* high_p, size_t* count_p);
+/*
+ *  @brief Find the index of the first element of a sized list of numbers equal to a given value.
+ *  @param List_t* The list to search, created with the element size of the type.
+ *  @param List_Num_Type The type of the elements.
+ *  @param const void* The value to find, of the element type.
+ *  @param size_t* A pointer in which to put the index found.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if no element is equal or any error that may occur.
+ */
+List_Error_t List_Find_Value(List_t* list_p, List_Num_Type type, const void* value_p, size_t* at_p);
 
 /*
  *  @brief Remove a given index from the list and destroy the data held within it.
@@ -284,12 +701,24 @@ List_Error_t List_Reduce(List_t* list_p, List_Reduce_Fnc reducer, void* accumula
 void List_Delete_At(size_t, List_t*);
 
 /*
- *  @brief Reverse a given list from its current order.
+ *  @brief Reverse a given list from its current order in O(1).
+ *	   Nothing is moved, the list just reads the other way from now on, and every function sees it that way.
+ *	   List_Concat, List_Splice, List_Split and List_Transfer lay a reversed list out the way it reads first, in O(n).
+ *	   Heaps are left alone.
  *  @param List_t* The list to reverse.
  *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
  */
 List_Error_t List_Reverse(List_t* list_p);
 
+/*
+ *  @brief Reverse a given list from its current order by relinking every node, or moving every element of a ring, in O(n).
+ *	   The order is the same as List_Reverse gives, but the list itself is laid out the other way.
+ *	   Heaps are left alone.
+ *  @param List_t* The list to reverse.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Reverse_In_Place(List_t* list_p);
+
 /*
  *  @brief Sort a given list using the set comparison function.
  *	   A list is considered sorted when precedence is in oredr from high to low
@@ -300,4 +729,196 @@ List_Error_t List_Reverse(List_t* list_p);
  */
 List_Error_t List_Sort(List_t* list_p, List_Cmp_Fnc cmp_fnc);
 
+/*
+ *  @brief Sort a given list like List_Sort, but without holding its lock while comparing.
+ *	   The list is snapshot under the lock and that snapshot is sorted without it, so other threads can
+ *	   keep using the list meanwhile and the lock is only held for O(n) to link in the new order.
+ *	   If the list is written while it is sorted the sort is taken again, and after a few attempts
+ *	   it falls back to List_Sort. Short lists are always sorted with List_Sort.
+ *	   Since comparisons happen without the lock, caller pointers removed from an unsized list meanwhile
+ *	   must not be freed until the sort returns.
+ *  @param List_t* The list to sort.
+ *  @param List_Cmp_Fnc An optional custom function pointer describing the precedence to use during sorting.
+						If NULL is used here, the list's default cmp function will be used
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Sort_Concurrent(List_t* list_p, List_Cmp_Fnc cmp_fnc);
+
+/*
+ *  @brief Sort a given list by an integer key extracted from every element, highest key first.
+ *	   Each key is extracted exactly once and the list is radix sorted on them, so no comparison function is ever called.
+ *	   Elements with equal keys keep their order.
+ *  @param List_t* The list to sort.
+ *  @param List_Key_Fnc The function giving the key of an element.
+ *  @param size_t The number of low bytes of the keys that can differ, 4 for 32-bit keys and 8 for 64-bit keys.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Sort_By_Key(List_t* list_p, List_Key_Fnc key_fnc, size_t key_width);
+
+/*
+ *  @brief Sort a given list by keys built once per element, for when comparing the elements themselves is expensive.
+ *	   Every key is built up front, the list is merge sorted comparing only keys, then every key is freed.
+ *	   Elements with equal keys keep their order.
+ *  @param List_t* The list to sort.
+ *  @param List_Copy_Fnc The function building the key of an element, returning NULL on failure.
+ *  @param List_Cmp_Fnc The function describing the precedence of two keys.
+ *  @param List_Free_Fnc The function used to free a key once sorting is done.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur, in which case the list is untouched.
+ */
+List_Error_t List_Sort_Decorated(List_t* list_p, List_Copy_Fnc key_fnc, List_Cmp_Fnc key_cmp, List_Free_Fnc key_free);
+
+/*
+ *  @brief Move every node of one list onto the end of another without copying or allocating.
+ *	   The source list is left empty but still valid. Nodes from the source's own pool are swapped for free nodes
+ *	   of the destination's pool, and only those it cant cover are allocated, in a single block.
+ *	   Both lists are locked in a consistent order so concurrent multi-list calls cannot deadlock.
+ *	   Compact lists cant share nodes, so when either list is compact the elements are copied over instead.
+ *  @param List_t* The list to append onto.
+ *  @param List_t* The list whose nodes should be moved, must differ from the first list.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Concat(List_t* list_p, List_t* other_p);
+
+/*
+ *  @brief Move a range of nodes from one list into another at a given index without copying or allocating.
+ *	   Only the walks needed to find both positions are performed. Moved nodes from the source's own pool are swapped
+ *	   for free nodes of the destination's pool, and only those it cant cover are allocated, in a single block.
+ *	   Compact lists cant share nodes, so when either list is compact the elements are copied over instead.
+ *  @param List_t* The list to move nodes into.
+ *  @param size_t The index in the destination list the first moved node should occupy.
+ *  @param List_t* The list to move nodes out of, must differ from the destination list.
+ *  @param size_t The index of the first node to move.
+ *  @param size_t The number of nodes to move.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Splice(List_t* list_p, size_t at, List_t* other_p, size_t from, size_t count);
+
+/*
+ *  @brief Split a list in two at a given index without copying or allocating nodes.
+ *	   The given list keeps every node before the index. Compact lists copy the moved elements into the new list.
+ *	   Moved nodes from the list's own pool go into the new list's pool, which has room for all of them.
+ *  @param List_t* The list to split.
+ *  @param size_t The index of the first node to move into the new list.
+ *  @return List_t* A pointer to a newly allocated list holding every node from the index onward or NULL on error.
+ *	   The new list shares the given list's max length, cmp and free functions.
+ */
+List_t* List_Split(List_t* list_p, size_t at);
+
+/*
+ *  @brief Move a single node from one list to a given position in another.
+ *	   The node itself is relinked while both lists are locked (in a consistent order), so observers of
+ *	   either list will always see the data in exactly one of them. Nothing is allocated unless the node came from
+ *	   the source's own pool and the destination's pool is full, in which case a single node is allocated to stand in.
+ *	   Compact lists cant share nodes, so moving into or out of one copies the element over instead.
+ *  @param List_t* The list to move the node out of.
+ *  @param size_t The index of the node to move.
+ *  @param List_t* The list to move the node into, this may be the same list.
+ *  @param size_t The index the node should occupy in the destination list once moved.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Transfer(List_t* list_p, size_t from, List_t* other_p, size_t at);
+
+/*
+ *  @brief Snapshot the data pointers of a list into a flat array, in list order, under a single lock.
+ *  @param List_t* The list to snapshot.
+ *  @param void** A caller provided array to fill or NULL to have one allocated (release it with free).
+ *  @param size_t The number of entries the caller provided array can hold, ignored when allocating.
+ *  @param size_t* A pointer in which to put the length of the list, which is also the number of entries written.
+ *	   This is set even when a caller provided array is too small, so the call can be retried.
+ *  @return void** The filled array or NULL on error.
+ */
+void** List_To_Array(List_t* list_p, void** array_p, size_t capacity, size_t* length_p);
+
+/*
+ *  @brief Create a list holding the entries of a flat array, in array order.
+ *	   Every node is allocated in a single block and linked in one pass.
+ *  @param void** The array of data to put into the list, no entry may be NULL.
+ *  @param size_t The number of entries in the array.
+ *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+ *  @param List_Cmp_Fnc A function used when comparing data within the list for matches or sorting.
+ *  @param List_Free_Fnc A function used when freeing data within the list.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_From_Array(void** array_p, size_t count, size_t max_length, List_Cmp_Fnc cmp, List_Free_Fnc free_fnc);
+
+/*
+ *  @brief Relocate every node of a list into one contiguous block laid out in traversal order.
+ *	   Pointer chasing through a compacted list walks memory sequentially instead of jumping around the heap.
+ *	   Any iterator currently on the list is invalidated, and so are pointers to the elements of a sized list.
+ *  @param List_t* The list to compact.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Compact(List_t* list_p);
+
+/*
+ *  @brief Have a list compact itself automatically once enough nodes have been inserted or removed.
+ *	   The check runs after each insertion or removal, so iterators must not be held across those while this is enabled.
+ *	   Sized lists with node storage are never compacted automatically, since it would move their elements.
+ *  @param List_t* The list to configure.
+ *  @param size_t The number of nodes linked or unlinked since the last compaction, as a percentage of the
+ *	   current length, that triggers the next one. 0 disables automatic compaction (the default).
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Set_Compact_Threshold(List_t* list_p, size_t percent);
+/*
+ *  @brief Start a pipeline over a list. Nothing is done to the list until the pipeline is reduced or collected.
+ *  @param List_t* The list the pipeline reads, which must outlive the pipeline.
+ *  @return List_Pipeline_p A pointer to an allocated pipeline with no stages or NULL on error.
+ */
+List_Pipeline_p List_Pipeline_Create(List_t* list_p);
+/*
+ *  @brief Add a stage replacing each value with the result of a function, like List_Copy does.
+ *  @param List_Pipeline_p The pipeline to add to.
+ *  @param List_Copy_Fnc The function giving the new value, NULL from it stops the pipeline with LIST_ERROR_BAD_ENTRY.
+ *  @param List_Free_Fnc The function freeing a new value once no later stage needs it, or NULL if they need no freeing.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the pipeline has no room left or any error that may occur.
+ */
+List_Error_t List_Pipeline_Map(List_Pipeline_p pipeline_p, List_Copy_Fnc map_fnc, List_Free_Fnc free_fnc);
+/*
+ *  @brief Add a stage only passing on the values a function returns true for.
+ *  @param List_Pipeline_p The pipeline to add to.
+ *  @param List_Find_Fnc The function testing each value.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the pipeline has no room left or any error that may occur.
+ */
+List_Error_t List_Pipeline_Filter(List_Pipeline_p pipeline_p, List_Find_Fnc keep_fnc);
+/*
+ *  @brief Add a stage passing on only the first values to reach it. The walk over the list stops once it has passed them all.
+ *  @param List_Pipeline_p The pipeline to add to.
+ *  @param size_t The number of values to pass on.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success, LIST_ERROR_EXCEED_LIMIT if the pipeline has no room left or any error that may occur.
+ */
+List_Error_t List_Pipeline_Take(List_Pipeline_p pipeline_p, size_t count);
+/*
+ *  @brief Run a pipeline, reducing every value that makes it through all the stages.
+ *  @param List_Pipeline_p The pipeline to run.
+ *  @param List_Reduce_Fnc The function used to reduce each value.
+ *  @param void* The value to begin reduction with.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Pipeline_Reduce(List_Pipeline_p pipeline_p, List_Reduce_Fnc reducer, void* accumulator);
+/*
+ *  @brief Run a pipeline, collecting every value that makes it through all the stages into a new list.
+ *	   Without a map stage the new list is set up like the one read and holds the same values, as List_Copy would without a copy function.
+ *	   With one it holds caller pointers to the mapped values and frees them with the free function of the last map stage, or never frees them if that is NULL.
+ *  @param List_Pipeline_p The pipeline to run.
+ *  @return List_t* A pointer to the allocated list or NULL on error.
+ */
+List_t* List_Pipeline_Collect(List_Pipeline_p pipeline_p);
+/*
+ *  @brief Free a pipeline. The list it reads is left alone.
+ *  @param List_Pipeline_p The pipeline to free.
+ *  @return void.
+ */
+void List_Pipeline_Destroy(List_Pipeline_p pipeline_p);
+/*
+ *  @brief Set how far ahead of themselves walks over a list fetch elements into cache.
+ *	   Scans such as List_Find, List_For_Each, List_Reduce and List_Copy keep a second cursor this many elements ahead,
+ *	   fetching its nodes and the caller data they hold, so a list scattered over more memory than the cache
+ *	   waits on memory less often. Sized ring storage is never fetched ahead since the hardware does that itself.
+ *  @param List_t* The list to configure.
+ *  @param size_t The number of elements to fetch ahead, 0 to not fetch ahead at all. The default is 8, the most 256.
+ *  @return List_Error_t LIST_ERROR_SUCCESS on success or any error that may occur.
+ */
+List_Error_t List_Set_Prefetch_Distance(List_t* list_p, size_t distance);
+
 #endif
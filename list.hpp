@@ -0,0 +1,421 @@
+/* 	@file list.hpp
+ *  @brief A header-only C++ wrapper owning a list of inline values, with the comparator inlined at compile time.
+ */
+
+#ifndef list_hpp
+#define list_hpp
+
+extern "C"
+{
+	#include "list.h"
+}
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace clist
+{
+	/*
+	 *  @brief Throw the exception matching a list error, if there was one.
+	 *  @param List_Error_t The error returned by the C library.
+	 *  @return void.
+	 */
+	inline void check(List_Error_t err)
+	{
+		switch (err)
+		{
+			case LIST_ERROR_SUCCESS:
+				return;
+			case LIST_ERROR_EXCEED_LIMIT:
+				throw std::length_error("clist: list is at its maximum length");
+			case LIST_ERROR_INVALID_PARAM:
+				throw std::invalid_argument("clist: invalid argument");
+			default:
+				throw std::bad_alloc();
+		}
+	}
+
+	/*
+	 *  @brief A list of values stored inline in its nodes, owning the List_t underneath it.
+	 *	   Cmp(a, b) is true when a has precedence over b, so sort() orders the list just like List_Sort would,
+	 *	   highest first by default. Since Cmp is a template parameter, sort() and find() call it directly
+	 *	   and the compiler can inline it, rather than going through a List_Cmp_Fnc.
+	 *	   The list can be moved but not copied, and like the standard containers it is not safe to use from
+	 *	   several threads at once, even though the C functions it calls lock.
+	 *	   Mutable references and iterators give the list storage of its own first, so writes through them never
+	 *	   show up in a List_Clone_COW of get(). Ones taken before the list is cloned must not be written through after.
+	 */
+	template <typename T, typename Cmp = std::greater<T>>
+	class list
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "clist::list copies its values with memcpy");
+
+	public:
+		typedef T value_type;
+		typedef T& reference;
+		typedef const T& const_reference;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+
+		/*
+		 *  @brief A bidirectional iterator walking the list through a List_Iterator_p kept in its own storage,
+		 *	   so iterators never allocate and copying one is just copying its bytes.
+		 *	   A default constructed or exhausted iterator is the end of the list.
+		 */
+		template <typename V>
+		class basic_iterator
+		{
+		public:
+			typedef std::bidirectional_iterator_tag iterator_category;
+			typedef T value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef V* pointer;
+			typedef V& reference;
+
+			basic_iterator() = default;
+			//a const_iterator can be made from an iterator but not the other way around
+			template <typename W, typename = typename std::enable_if<std::is_same<V, const W>::value>::type>
+			basic_iterator(const basic_iterator<W>& other)
+				: list_p(other.list_p), storage(other.storage), started(other.started), from_back(other.from_back)
+			{
+			}
+
+			reference operator*() const
+			{
+				return *static_cast<V*>(List_Iterator_Curr(handle()));
+			}
+			pointer operator->() const
+			{
+				return static_cast<V*>(List_Iterator_Curr(handle()));
+			}
+			basic_iterator& operator++()
+			{
+				if (from_back)
+				{
+					List_Iterator_Prev(handle());
+				}
+				else
+				{
+					List_Iterator_Next(handle());
+				}
+				return *this;
+			}
+			basic_iterator operator++(int)
+			{
+				basic_iterator ret_val(*this);
+				++(*this);
+				return ret_val;
+			}
+			basic_iterator& operator--()
+			{
+				//stepping back from the end starts a walk from the back of the list
+				if (!started)
+				{
+					own<V>(list_p);
+					started = (nullptr != List_Iterator_Init(&storage, list_p, true));
+					from_back = true;
+				}
+				if (from_back)
+				{
+					List_Iterator_Next(handle());
+				}
+				else
+				{
+					List_Iterator_Prev(handle());
+				}
+				return *this;
+			}
+			basic_iterator operator--(int)
+			{
+				basic_iterator ret_val(*this);
+				--(*this);
+				return ret_val;
+			}
+			//every element has its own inline storage, so two iterators are equal when they point at the same one
+			friend bool operator==(const basic_iterator& a, const basic_iterator& b)
+			{
+				return List_Iterator_Curr(a.handle()) == List_Iterator_Curr(b.handle());
+			}
+			friend bool operator!=(const basic_iterator& a, const basic_iterator& b)
+			{
+				return !(a == b);
+			}
+
+		private:
+			friend class list;
+			template <typename W>
+			friend class basic_iterator;
+
+			explicit basic_iterator(List_t* list_p)
+				: list_p(list_p)
+			{
+			}
+			List_Iterator_p handle() const
+			{
+				//List_Iterator_Init hands back the storage itself
+				return started ? reinterpret_cast<List_Iterator_p>(const_cast<List_Iterator_Storage*>(&storage)) : nullptr;
+			}
+
+			List_t* list_p = nullptr;
+			List_Iterator_Storage storage = {};
+			bool started = false;
+			bool from_back = false;
+		};
+		typedef basic_iterator<T> iterator;
+		typedef basic_iterator<const T> const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+		/*
+		 *  @brief Create an empty list.
+		 *  @param size_t The maximum size to allow the list to grow, 0 for no maximum.
+		 */
+		explicit list(size_type max_length = 0)
+			: list_p(List_Create_Sized(sizeof(T), max_length, &list::c_cmp))
+		{
+			if (nullptr == list_p)
+			{
+				throw std::bad_alloc();
+			}
+		}
+		list(std::initializer_list<T> values)
+			: list()
+		{
+			for (const T& value : values)
+			{
+				push_back(value);
+			}
+		}
+		list(list&& other) noexcept
+			: list_p(std::exchange(other.list_p, nullptr))
+		{
+		}
+		list& operator=(list&& other) noexcept
+		{
+			std::swap(list_p, other.list_p);
+			return *this;
+		}
+		list(const list&) = delete;
+		list& operator=(const list&) = delete;
+		~list()
+		{
+			List_Destroy(list_p);
+		}
+
+		/*
+		 *  @brief Get the list underneath, to pass to the C functions. It stays owned by this object.
+		 */
+		List_t* get() const noexcept
+		{
+			return list_p;
+		}
+
+		size_type size() const noexcept
+		{
+			return List_Length(list_p);
+		}
+		bool empty() const noexcept
+		{
+			return 0 == size();
+		}
+
+		reference operator[](size_type at)
+		{
+			own<T>(list_p);
+			return *static_cast<T*>(List_At(at, list_p));
+		}
+		const_reference operator[](size_type at) const
+		{
+			return *static_cast<const T*>(List_At(at, list_p));
+		}
+		reference at(size_type at)
+		{
+			own<T>(list_p);
+			T* value_p = static_cast<T*>(List_At(at, list_p));
+			if (nullptr == value_p)
+			{
+				throw std::out_of_range("clist: index out of range");
+			}
+			return *value_p;
+		}
+		reference front()
+		{
+			return (*this)[0];
+		}
+		reference back()
+		{
+			return (*this)[size() - 1];
+		}
+
+		void push_back(const T& value)
+		{
+			check(List_Push(const_cast<T*>(&value), list_p));
+		}
+		void push_front(const T& value)
+		{
+			check(List_Unshift(const_cast<T*>(&value), list_p));
+		}
+		void insert(size_type at, const T& value)
+		{
+			check(List_Insert(const_cast<T*>(&value), at, list_p));
+		}
+		/*
+		 *  @brief Remove the last value, doing nothing if the list is empty.
+		 */
+		void pop_back() noexcept
+		{
+			List_Pop_Into(list_p, nullptr);
+		}
+		/*
+		 *  @brief Remove the first value, doing nothing if the list is empty.
+		 */
+		void pop_front() noexcept
+		{
+			List_Shift_Into(list_p, nullptr);
+		}
+		void erase(size_type at) noexcept
+		{
+			List_Delete_At(at, list_p);
+		}
+		void clear() noexcept
+		{
+			List_Purge(list_p);
+		}
+		void reverse()
+		{
+			check(List_Reverse(list_p));
+		}
+
+		/*
+		 *  @brief Stable sort the list by Cmp, values with precedence first.
+		 *	   The values are gathered with one call into the C library, sorted with Cmp inlined, and written back in place.
+		 */
+		void sort()
+		{
+			size_t count = 0;
+			T** values_pp = reinterpret_cast<T**>(List_To_Array(list_p, nullptr, 0, &count));
+			if (nullptr == values_pp)
+			{
+				throw std::bad_alloc();
+			}
+			std::vector<T> sorted;
+			try
+			{
+				sorted.reserve(count);
+			}
+			catch (...)
+			{
+				std::free(values_pp);
+				throw;
+			}
+			for (size_t i = 0; i < count; i++)
+			{
+				sorted.push_back(*values_pp[i]);
+			}
+			std::stable_sort(sorted.begin(), sorted.end(), Cmp());
+			for (size_t i = 0; i < count; i++)
+			{
+				*values_pp[i] = sorted[i];
+			}
+			std::free(values_pp);
+		}
+
+		/*
+		 *  @brief Find the first value neither having nor lacking precedence over a given one by Cmp.
+		 *  @return iterator The value found or end() if there is none.
+		 */
+		iterator find(const T& value)
+		{
+			Cmp cmp;
+			for (iterator it = begin(); it != end(); ++it)
+			{
+				if (!cmp(*it, value) && !cmp(value, *it))
+				{
+					return it;
+				}
+			}
+			return end();
+		}
+
+		iterator begin()
+		{
+			return first<iterator>();
+		}
+		iterator end() noexcept
+		{
+			return iterator(list_p);
+		}
+		const_iterator begin() const
+		{
+			return first<const_iterator>();
+		}
+		const_iterator end() const noexcept
+		{
+			return const_iterator(list_p);
+		}
+		const_iterator cbegin() const
+		{
+			return begin();
+		}
+		const_iterator cend() const noexcept
+		{
+			return end();
+		}
+		reverse_iterator rbegin()
+		{
+			return reverse_iterator(end());
+		}
+		reverse_iterator rend()
+		{
+			return reverse_iterator(begin());
+		}
+
+	private:
+		/*
+		 *  @brief Give a list storage of its own before a mutable reference into it is handed out.
+		 *	   Const references only ever read, so they leave the storage shared.
+		 *  @param List_t* The list about to hand out a reference of type V.
+		 */
+		template <typename V>
+		static void own(List_t* list_p)
+		{
+			if (!std::is_const<V>::value && nullptr != list_p)
+			{
+				check(List_Own_Storage(list_p));
+			}
+		}
+
+		/*
+		 *  @brief The List_Cmp_Fnc given to the C library, so functions like List_Find and List_Peek_Max agree with Cmp.
+		 */
+		static int c_cmp(const void* a_p, const void* b_p)
+		{
+			Cmp cmp;
+			const T& a = *static_cast<const T*>(a_p);
+			const T& b = *static_cast<const T*>(b_p);
+			return cmp(a, b) ? 1 : (cmp(b, a) ? -1 : 0);
+		}
+
+		template <typename It>
+		It first() const
+		{
+			own<typename std::remove_reference<typename It::reference>::type>(list_p);
+			It it(list_p);
+			it.started = (nullptr != List_Iterator_Init(&(it.storage), list_p, false));
+			List_Iterator_Next(it.handle());
+			return it;
+		}
+
+		List_t* list_p;
+	};
+}
+
+#endif
@@ -0,0 +1,270 @@
+/* 	@file list_define.h
+ *  @brief A generator for typed lists of inline values whose comparison is inlined rather than called through a pointer.
+ */
+
+#ifndef list_define_h
+#define list_define_h
+
+#include "list.h"
+
+//storage for a value local to each thread, which handing typed callbacks to the generic functions relies on
+#ifdef __cplusplus
+#define LIST_DEFINE_THREAD_LOCAL thread_local
+#else
+#define LIST_DEFINE_THREAD_LOCAL _Thread_local
+#endif
+
+/*
+ *  @brief The state of a typed Find, walked over a chunk at a time.
+ */
+typedef struct List_Define_Find
+{
+	const void* value_p; //the value to find
+	size_t seen; //values walked before the current chunk
+	size_t at; //where the value was found
+}
+List_Define_Find;
+
+/*
+ *  @brief The state of a typed Sort, which sorts the whole list as a single chunk.
+ */
+typedef struct List_Define_Sort
+{
+	size_t chunks; //chunks the walk handed over, more than one if the list grew after its length was read
+	List_Error_t ret_val; //how sorting the first chunk went
+}
+List_Define_Sort;
+
+/*
+ *  @brief The state of a typed Reduce, walked over a chunk at a time.
+ */
+typedef struct List_Define_Reduce
+{
+	void* reducer_p; //the typed reducer, a pointer to a name_Reduce_Fnc
+	void* accumulator; //the accumulator so far
+}
+List_Define_Reduce;
+
+/*
+ *  @brief Define a typed list of inline T values named name, with every operation prefixed name_.
+ *	   cmp_expr is an int expression over two const T* named a and b, greater than 0 when a has precedence,
+ *	   exactly like a List_Cmp_Fnc. It is pasted into name_Cmp, so sorting and finding compare inline.
+ *	   A typed list is a sized List_t underneath, name_List gives it back for any generic function.
+ *	   The typed Find, Filter, Sort, For_Each and Reduce each run under a single hold of the list's lock, like the generic
+ *	   functions, so they are safe on a list shared between threads. Their callbacks must not call into the same list.
+ *
+ *	   LIST_DEFINE(Int_List, int, (*a > *b) - (*a < *b))
+ *	   Int_List* list_p = Int_List_Create(0);
+ *	   Int_List_Push(list_p, 42);
+ */
+#define LIST_DEFINE(name, T, cmp_expr) \
+	typedef struct name name; \
+	typedef bool (*name##_Find_Fnc) (const T*); \
+	typedef void (*name##_Do_Fnc) (T*); \
+	typedef void* (*name##_Reduce_Fnc) (const T*, void*); \
+	\
+	/* the test of the typed Filter running on this thread, List_Filter has no context to carry it */ \
+	static LIST_DEFINE_THREAD_LOCAL name##_Find_Fnc name##_keep_fnc = NULL; \
+	\
+	static inline int name##_Cmp(const T* a, const T* b) \
+	{ \
+		return (cmp_expr); \
+	} \
+	static inline int name##_Cmp_Fnc(const void* a_p, const void* b_p) \
+	{ \
+		return name##_Cmp((const T*)a_p, (const T*)b_p); \
+	} \
+	static inline name* name##_Create(size_t max_length) \
+	{ \
+		return (name*)List_Create_Sized(sizeof(T), max_length, name##_Cmp_Fnc); \
+	} \
+	static inline void name##_Destroy(name* list_p) \
+	{ \
+		List_Destroy((List_t*)list_p); \
+	} \
+	static inline List_t* name##_List(name* list_p) \
+	{ \
+		return (List_t*)list_p; \
+	} \
+	static inline size_t name##_Length(name* list_p) \
+	{ \
+		return List_Length((List_t*)list_p); \
+	} \
+	static inline List_Error_t name##_Push(name* list_p, T value) \
+	{ \
+		return List_Push(&value, (List_t*)list_p); \
+	} \
+	static inline List_Error_t name##_Unshift(name* list_p, T value) \
+	{ \
+		return List_Unshift(&value, (List_t*)list_p); \
+	} \
+	static inline List_Error_t name##_Pop(name* list_p, T* out_p) \
+	{ \
+		return List_Pop_Into((List_t*)list_p, out_p); \
+	} \
+	static inline List_Error_t name##_Shift(name* list_p, T* out_p) \
+	{ \
+		return List_Shift_Into((List_t*)list_p, out_p); \
+	} \
+	static inline T* name##_At(name* list_p, size_t at) \
+	{ \
+		return (T*)List_At(at, (List_t*)list_p); \
+	} \
+	static inline bool name##_Find_Chunk(void** values_pp, size_t count, void* ctx_p) \
+	{ \
+		List_Define_Find* find_p = (List_Define_Find*)ctx_p; \
+		for (size_t i = 0; i < count; i++) \
+		{ \
+			if (0 == name##_Cmp((const T*)values_pp[i], (const T*)find_p->value_p)) \
+			{ \
+				find_p->at = find_p->seen + i; \
+				return true; \
+			} \
+		} \
+		find_p->seen += count; \
+		return false; \
+	} \
+	/* find the first value comparing equal to a given one, LIST_ERROR_EXCEED_LIMIT if there is none */ \
+	static inline List_Error_t name##_Find(name* list_p, T value, size_t* at_p) \
+	{ \
+		if (NULL == list_p || NULL == at_p) \
+		{ \
+			return LIST_ERROR_INVALID_PARAM; \
+		} \
+		List_Define_Find find = { &value, 0, 0 }; \
+		if (!List_Some_Chunk((List_t*)list_p, name##_Find_Chunk, 0, &find)) \
+		{ \
+			return LIST_ERROR_EXCEED_LIMIT; \
+		} \
+		*at_p = find.at; \
+		return LIST_ERROR_SUCCESS; \
+	} \
+	static inline bool name##_Keep(const void* value_p) \
+	{ \
+		return name##_keep_fnc((const T*)value_p); \
+	} \
+	/* keep only the values passing a test, as List_Filter does */ \
+	static inline List_Error_t name##_Filter(name* list_p, name##_Find_Fnc keep_fnc) \
+	{ \
+		if (NULL == list_p || NULL == keep_fnc) \
+		{ \
+			return LIST_ERROR_INVALID_PARAM; \
+		} \
+		/* the test may filter another list of this type itself */ \
+		name##_Find_Fnc outer_fnc = name##_keep_fnc; \
+		name##_keep_fnc = keep_fnc; \
+		List_Error_t ret_val = List_Filter((List_t*)list_p, name##_Keep); \
+		name##_keep_fnc = outer_fnc; \
+		return ret_val; \
+	} \
+	/* stable merge sort a chunk of values with name_Cmp inlined, highest precedence first, then write them back in place */ \
+	static inline void name##_Sort_Chunk(void** values_pp, size_t count, void* ctx_p) \
+	{ \
+		List_Define_Sort* sort_p = (List_Define_Sort*)ctx_p; \
+		if (0 != sort_p->chunks++) \
+		{ \
+			return; \
+		} \
+		T* from_p = (T*)malloc((0 != count ? 2 * count : 1) * sizeof(T)); \
+		if (NULL == from_p) \
+		{ \
+			sort_p->ret_val = LIST_ERROR_FAILURE; \
+			return; \
+		} \
+		T* sorted_p = from_p; \
+		T* to_p = from_p + count; \
+		for (size_t i = 0; i < count; i++) \
+		{ \
+			from_p[i] = *(T*)values_pp[i]; \
+		} \
+		for (size_t width = 1; width < count; width *= 2) \
+		{ \
+			for (size_t left = 0; left < count; left += 2 * width) \
+			{ \
+				size_t mid = (left + width < count) ? left + width : count; \
+				size_t right = (mid + width < count) ? mid + width : count; \
+				size_t i = left; \
+				size_t j = mid; \
+				size_t k = left; \
+				while (i < mid && j < right) \
+				{ \
+					to_p[k++] = (0 > name##_Cmp(&from_p[i], &from_p[j])) ? from_p[j++] : from_p[i++]; \
+				} \
+				while (i < mid) \
+				{ \
+					to_p[k++] = from_p[i++]; \
+				} \
+				while (j < right) \
+				{ \
+					to_p[k++] = from_p[j++]; \
+				} \
+			} \
+			T* tmp_p = from_p; \
+			from_p = to_p; \
+			to_p = tmp_p; \
+		} \
+		for (size_t i = 0; i < count; i++) \
+		{ \
+			*(T*)values_pp[i] = from_p[i]; \
+		} \
+		free(sorted_p); \
+	} \
+	/* sort the whole list as one chunk under its lock, or with List_Sort if it grew after its length was read */ \
+	static inline List_Error_t name##_Sort(name* list_p) \
+	{ \
+		if (NULL == list_p) \
+		{ \
+			return LIST_ERROR_INVALID_PARAM; \
+		} \
+		List_Define_Sort sort = { 0, LIST_ERROR_SUCCESS }; \
+		size_t length = List_Length((List_t*)list_p); \
+		List_Error_t ret_val = List_For_Each_Chunk((List_t*)list_p, name##_Sort_Chunk, (0 != length) ? length : 1, &sort); \
+		if (LIST_ERROR_SUCCESS != ret_val) \
+		{ \
+			return ret_val; \
+		} \
+		if (LIST_ERROR_SUCCESS != sort.ret_val) \
+		{ \
+			return sort.ret_val; \
+		} \
+		return (1 < sort.chunks) ? List_Sort((List_t*)list_p, name##_Cmp_Fnc) : LIST_ERROR_SUCCESS; \
+	} \
+	static inline void name##_For_Each_Chunk(void** values_pp, size_t count, void* ctx_p) \
+	{ \
+		name##_Do_Fnc do_fnc = *(name##_Do_Fnc*)ctx_p; \
+		for (size_t i = 0; i < count; i++) \
+		{ \
+			do_fnc((T*)values_pp[i]); \
+		} \
+	} \
+	static inline List_Error_t name##_For_Each(name* list_p, name##_Do_Fnc do_fnc) \
+	{ \
+		if (NULL == list_p || NULL == do_fnc) \
+		{ \
+			return LIST_ERROR_INVALID_PARAM; \
+		} \
+		return List_For_Each_Chunk((List_t*)list_p, name##_For_Each_Chunk, 0, &do_fnc); \
+	} \
+	/* reducing only reads, so it walks like a search that never finds anything and shared storage isnt copied */ \
+	static inline bool name##_Reduce_Chunk(void** values_pp, size_t count, void* ctx_p) \
+	{ \
+		List_Define_Reduce* reduce_p = (List_Define_Reduce*)ctx_p; \
+		name##_Reduce_Fnc reducer = *(name##_Reduce_Fnc*)reduce_p->reducer_p; \
+		for (size_t i = 0; i < count; i++) \
+		{ \
+			reduce_p->accumulator = reducer((const T*)values_pp[i], reduce_p->accumulator); \
+		} \
+		return false; \
+	} \
+	static inline List_Error_t name##_Reduce(name* list_p, name##_Reduce_Fnc reducer, void* accumulator) \
+	{ \
+		if (NULL == list_p || NULL == reducer || NULL == accumulator) \
+		{ \
+			return LIST_ERROR_INVALID_PARAM; \
+		} \
+		List_Define_Reduce reduce = { &reducer, accumulator }; \
+		List_Some_Chunk((List_t*)list_p, name##_Reduce_Chunk, 0, &reduce); \
+		return LIST_ERROR_SUCCESS; \
+	}
+
+#endif
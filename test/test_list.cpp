@@ -1,8 +1,47 @@
 extern "C"
 {
         #include "list.h"
+        #include "list_define.h"
 }
+#include "list.hpp"
 #include "gtest/gtest.h"
+#include <numeric>
+#include <atomic>
+#include <thread>
+
+//count allocations so tests can check a path doesnt allocate, sanitizers bring their own malloc
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define TEST_NO_ALLOC_COUNT
+#endif
+#endif
+#if defined(__SANITIZE_ADDRESS__) || !defined(__GLIBC__)
+#define TEST_NO_ALLOC_COUNT
+#endif
+std::atomic<size_t> alloc_count(0);
+#ifndef TEST_NO_ALLOC_COUNT
+extern "C"
+{
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* ptr, size_t size);
+    void* malloc(size_t size)
+    {
+        alloc_count++;
+        return __libc_malloc(size);
+    }
+    void* calloc(size_t count, size_t size)
+    {
+        alloc_count++;
+        return __libc_calloc(count, size);
+    }
+    void* realloc(void* ptr, size_t size)
+    {
+        alloc_count++;
+        return __libc_realloc(ptr, size);
+    }
+}
+#endif
 
 //setup stuff
 int test_cmp_fnc(const void* a, const void* b)
@@ -15,12 +54,25 @@ void test_free_fnc(void* a)
     (void)a;
     return;
 }
+//test List_Free_Fnc counting the values it frees
+size_t freed_count = 0;
+void counting_free_fnc(void* a)
+{
+    freed_count++;
+    free(a);
+}
 //test List_Find_Fnc
 bool is_not_255(const void* a)
 {
     if (*(int*)a == 255) return false;
     return true;
 }
+//test List_Copy_Fnc giving values that need no freeing
+int test_table[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+void* table_int(const void* a)
+{
+    return &test_table[*(int*)a % 10];
+}
 //test List_Find_Fnc
 void* double_int(const void* a)
 {
@@ -28,6 +80,12 @@ void* double_int(const void* a)
     *(int*)ret_int = (*(int*)a) * 2;
     return ret_int;
 }
+//test List_Copy_Fnc
+void* copy_unless_255(const void* a)
+{
+    if (*(int*)a == 255) return NULL;
+    return double_int(a);
+}
 //test List_do_fnc
 void half_int(void* a)
 {
@@ -39,6 +97,159 @@ void* avg_reducer(const void* a, void* acc)
     *(int*)acc += *(int*)a;
     return acc;
 }
+//test List_Find_Fnc
+bool is_even(const void* a)
+{
+    return 0 == *(int*)a % 2;
+}
+//test List_Find_Fnc counting the values it has been given
+size_t seen_count = 0;
+bool count_seen(const void* a)
+{
+    (void)a;
+    seen_count++;
+    return true;
+}
+//test List_Key_Fnc
+uint64_t int_key(const void* a)
+{
+    return (uint64_t)(uint32_t)*(int*)a;
+}
+//test List_Cmp_Fnc writing to write_list as another thread could, the first write_count times it compares 0 and 1
+List_t* write_list = NULL;
+size_t write_count = 0;
+int writing_cmp_fnc(const void* a, const void* b)
+{
+    if (0 < write_count && 0 == *(int*)a && 1 == *(int*)b)
+    {
+        write_count--;
+        int value = -1;
+        List_Push(&value, write_list);
+    }
+    return test_cmp_fnc(a, b);
+}
+//test List_Cmp_Fnc removing the last element of write_list into removed_p the first write_count times it compares 0 and 1
+void* removed_p = NULL;
+int removing_cmp_fnc(const void* a, const void* b)
+{
+    if (0 < write_count && 0 == *(int*)a && 1 == *(int*)b)
+    {
+        write_count--;
+        removed_p = List_Remove_At(List_Length(write_list) - 1, write_list);
+    }
+    return test_cmp_fnc(a, b);
+}
+
+//sized list of count values from first to last in every storage, the ring wrapped around its array
+List_t* num_list(int storage, size_t elem_size, const void* values, size_t count)
+{
+    List_t* list = (0 == storage) ? List_Create_Sized(elem_size, 0, NULL)
+        : (1 == storage) ? List_Create_Compact_Sized(elem_size, 0, NULL) : List_Create_Deque_Sized(elem_size, 0, NULL);
+    size_t front = (2 == storage) ? count / 3 : 0;
+    for (size_t i = front; i < count; i++)
+    {
+        List_Push((void*)((const char*)values + i * elem_size), list);
+    }
+    for (size_t i = front; i > 0; i--)
+    {
+        List_Unshift((void*)((const char*)values + (i - 1) * elem_size), list);
+    }
+    return list;
+}
+//check a sized list holds exactly the given ints in order, read every way the library reads a list
+void expect_ints(List_t* list, const std::vector<int>& vals)
+{
+    ASSERT_EQ(List_Length(list), vals.size());
+    size_t count = 0;
+    void** items = List_To_Array(list, NULL, 0, &count);
+    ASSERT_NE(items, nullptr);
+    List_Iterator_p iter_p = List_Iterator_Create(list);
+    List_Iterator_p back_iter_p = List_Iterator_Create_Reverse(list);
+    for (size_t i = 0; i < vals.size(); i++)
+    {
+        EXPECT_EQ(*(int*)items[i], vals[i]);
+        EXPECT_EQ(*(int*)List_At(i, list), vals[i]);
+        EXPECT_EQ(*(int*)List_Iterator_Next(iter_p), vals[i]);
+        EXPECT_EQ(*(int*)List_Iterator_Next(back_iter_p), vals[vals.size() - 1 - i]);
+    }
+    size_t at = 0;
+    LIST_FOREACH(list, item)
+    {
+        EXPECT_EQ(*(int*)item, vals[at++]);
+    }
+    EXPECT_EQ(at, vals.size());
+    free(items);
+    List_Iterator_Destroy(iter_p);
+    List_Iterator_Destroy(back_iter_p);
+}
+//test List_Cmp_Fnc comparing ints by their tens only, so ties show whether a sort kept their order
+int tens_cmp_fnc(const void* a, const void* b)
+{
+    return (*(int*)a / 10) - (*(int*)b / 10);
+}
+//test typed list
+LIST_DEFINE(Int_List, int, (*a > *b) - (*a < *b))
+bool int_is_odd(const int* a)
+{
+    return 0 != (*a % 2);
+}
+//typed tests giving other threads a turn in the middle of a walk
+bool int_is_odd_yield(const int* a)
+{
+    std::this_thread::yield();
+    return int_is_odd(a);
+}
+//typed test filtering another typed list from inside a filter
+Int_List* inner_list = NULL;
+bool int_is_odd_filtering(const int* a)
+{
+    Int_List_Filter(inner_list, int_is_odd);
+    return 0 != (*a % 2);
+}
+void int_double(int* a)
+{
+    *a *= 2;
+}
+void int_double_yield(int* a)
+{
+    std::this_thread::yield();
+    int_double(a);
+}
+void* int_sum(const int* a, void* acc)
+{
+    *(int*)acc += *a;
+    return acc;
+}
+//test List_Chunk_Fnc, sums the chunk into ctx and counts the chunks
+struct chunk_sum
+{
+    int sum;
+    size_t chunks;
+    size_t largest;
+};
+void sum_chunk(void** items, size_t count, void* ctx)
+{
+    struct chunk_sum* acc = (struct chunk_sum*)ctx;
+    for (size_t i = 0; i < count; i++)
+    {
+        acc->sum += *(int*)items[i];
+    }
+    acc->chunks++;
+    if (count > acc->largest) acc->largest = count;
+}
+//test List_Chunk_Find_Fnc, puts the first item equal to *ctx back in ctx
+bool chunk_has(void** items, size_t count, void* ctx)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (*(int*)items[i] == **(int**)ctx)
+        {
+            *(int**)ctx = (int*)items[i];
+            return true;
+        }
+    }
+    return false;
+}
 
 //test values for list population
 int test_val1 = 255;
@@ -415,6 +626,388 @@ int test_val3 = 63;
     }
 //}
 
+//List_Sum
+//{
+    //Tests a valid usage over every storage and more elements than one gathered block
+    TEST(ListSumTest, ValidArgs) {
+        std::vector<int32_t> ints(1000);
+        std::vector<int64_t> longs(1000);
+        std::vector<float> floats(1000);
+        std::vector<double> doubles(1000);
+        int64_t int_sum = 0;
+        int64_t long_sum = 0;
+        for (size_t i = 0; i < 1000; i++)
+        {
+            ints[i] = (int32_t)(i * 7919 % 2001) - 1000;
+            longs[i] = (int64_t)ints[i] * ((int64_t)1 << 33);
+            floats[i] = (float)ints[i] / 4;
+            doubles[i] = (double)ints[i] / 8;
+            int_sum += ints[i];
+            long_sum += longs[i];
+        }
+        for (int storage = 0; storage < 3; storage++)
+        {
+            int64_t sum = 0;
+            double float_sum = 0;
+            List_t* test_list = num_list(storage, sizeof(int32_t), ints.data(), ints.size());
+            EXPECT_EQ(List_Sum(test_list, LIST_NUM_INT32, &sum), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(sum, int_sum);
+            List_Destroy(test_list);
+
+            test_list = num_list(storage, sizeof(int64_t), longs.data(), longs.size());
+            EXPECT_EQ(List_Sum(test_list, LIST_NUM_INT64, &sum), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(sum, long_sum);
+            List_Destroy(test_list);
+
+            //quarters and eighths of small integers add up exactly in any order
+            test_list = num_list(storage, sizeof(float), floats.data(), floats.size());
+            EXPECT_EQ(List_Sum(test_list, LIST_NUM_FLOAT, &float_sum), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(float_sum, (double)int_sum / 4);
+            List_Destroy(test_list);
+
+            test_list = num_list(storage, sizeof(double), doubles.data(), doubles.size());
+            EXPECT_EQ(List_Sum(test_list, LIST_NUM_DOUBLE, &float_sum), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(float_sum, (double)int_sum / 8);
+            List_Destroy(test_list);
+        }
+    }
+    //Tests a valid usage
+    TEST(ListSumTest, ValidEmpty) {
+        List_t* test_list = List_Create_Sized(sizeof(int32_t), 0, NULL);
+
+        int64_t sum = 42;
+        EXPECT_EQ(List_Sum(test_list, LIST_NUM_INT32, &sum), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(sum, 0);
+
+        List_Destroy(test_list);
+    }
+    //Test List sum with improper args
+    TEST(ListSumTest, InvalidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int32_t), 0, NULL);
+        List_t* pointer_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        int64_t sum = 0;
+        EXPECT_EQ(List_Sum(NULL, LIST_NUM_INT32, &sum), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sum(test_list, LIST_NUM_INT32, NULL), LIST_ERROR_INVALID_PARAM);
+        //the element size has to match the type
+        EXPECT_EQ(List_Sum(test_list, LIST_NUM_INT64, &sum), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sum(test_list, (List_Num_Type)7, &sum), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sum(pointer_list, LIST_NUM_INT32, &sum), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(pointer_list);
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Min and List_Max
+//{
+    //Tests a valid usage over every storage
+    TEST(ListMinMaxTest, ValidArgs) {
+        std::vector<int32_t> ints(1000);
+        std::vector<double> doubles(1000);
+        for (size_t i = 0; i < 1000; i++)
+        {
+            ints[i] = (int32_t)(i * 7919 % 1009) - 500;
+            doubles[i] = ints[i] * 0.5;
+        }
+        //extremes at the very first and last elements too
+        ints[0] = -2000;
+        ints[999] = 3000;
+        doubles[500] = -4000.5;
+        doubles[3] = 1e9;
+        for (int storage = 0; storage < 3; storage++)
+        {
+            int32_t int_val = 0;
+            double double_val = 0;
+            List_t* test_list = num_list(storage, sizeof(int32_t), ints.data(), ints.size());
+            EXPECT_EQ(List_Min(test_list, LIST_NUM_INT32, &int_val), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(int_val, -2000);
+            EXPECT_EQ(List_Max(test_list, LIST_NUM_INT32, &int_val), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(int_val, 3000);
+            List_Destroy(test_list);
+
+            test_list = num_list(storage, sizeof(double), doubles.data(), doubles.size());
+            EXPECT_EQ(List_Min(test_list, LIST_NUM_DOUBLE, &double_val), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(double_val, -4000.5);
+            EXPECT_EQ(List_Max(test_list, LIST_NUM_DOUBLE, &double_val), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(double_val, 1e9);
+            List_Destroy(test_list);
+        }
+    }
+    //Test List min and max with improper args
+    TEST(ListMinMaxTest, InvalidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(float), 0, NULL);
+
+        float val = 0;
+        EXPECT_EQ(List_Min(test_list, LIST_NUM_FLOAT, &val), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Max(test_list, LIST_NUM_FLOAT, &val), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Min(NULL, LIST_NUM_FLOAT, &val), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Max(test_list, LIST_NUM_FLOAT, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Max(test_list, LIST_NUM_DOUBLE, &val), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Count_If_Range
+//{
+    //Tests a valid usage over every storage
+    TEST(ListCountIfRangeTest, ValidArgs) {
+        std::vector<int64_t> longs(1000);
+        std::vector<float> floats(1000);
+        for (size_t i = 0; i < 1000; i++)
+        {
+            longs[i] = (int64_t)i - 500;
+            floats[i] = (float)i / 2;
+        }
+        for (int storage = 0; storage < 3; storage++)
+        {
+            size_t count = 0;
+            int64_t low = -10;
+            int64_t high = 10;
+            List_t* test_list = num_list(storage, sizeof(int64_t), longs.data(), longs.size());
+            EXPECT_EQ(List_Count_If_Range(test_list, LIST_NUM_INT64, &low, &high, &count), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(count, 21);
+            //an empty range
+            EXPECT_EQ(List_Count_If_Range(test_list, LIST_NUM_INT64, &high, &low, &count), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(count, 0);
+            List_Destroy(test_list);
+
+            float float_low = 100;
+            float float_high = 1000;
+            test_list = num_list(storage, sizeof(float), floats.data(), floats.size());
+            EXPECT_EQ(List_Count_If_Range(test_list, LIST_NUM_FLOAT, &float_low, &float_high, &count), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(count, 800);
+            List_Destroy(test_list);
+        }
+    }
+    //Test List count if range with improper args
+    TEST(ListCountIfRangeTest, InvalidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int32_t), 0, NULL);
+
+        int32_t low = 0;
+        int32_t high = 1;
+        size_t count = 0;
+        EXPECT_EQ(List_Count_If_Range(NULL, LIST_NUM_INT32, &low, &high, &count), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Count_If_Range(test_list, LIST_NUM_INT32, NULL, &high, &count), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Count_If_Range(test_list, LIST_NUM_INT32, &low, NULL, &count), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Count_If_Range(test_list, LIST_NUM_INT32, &low, &high, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Count_If_Range(test_list, LIST_NUM_DOUBLE, &low, &high, &count), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Find_Value
+//{
+    //Tests a valid usage over every storage, the first of several matches being found
+    TEST(ListFindValueTest, ValidArgs) {
+        std::vector<int32_t> ints(1000);
+        for (size_t i = 0; i < 1000; i++)
+        {
+            ints[i] = (int32_t)i;
+        }
+        ints[700] = 5;
+        for (int storage = 0; storage < 3; storage++)
+        {
+            size_t at = 0;
+            List_t* test_list = num_list(storage, sizeof(int32_t), ints.data(), ints.size());
+            for (int32_t value : {0, 5, 333, 517, 999})
+            {
+                EXPECT_EQ(List_Find_Value(test_list, LIST_NUM_INT32, &value, &at), LIST_ERROR_SUCCESS);
+                EXPECT_EQ(at, (size_t)value);
+            }
+            int32_t missing = 700;
+            at = 42;
+            EXPECT_EQ(List_Find_Value(test_list, LIST_NUM_INT32, &missing, &at), LIST_ERROR_EXCEED_LIMIT);
+            EXPECT_EQ(at, 42);
+            List_Destroy(test_list);
+        }
+    }
+    //Test List find value with improper args
+    TEST(ListFindValueTest, InvalidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(double), 0, NULL);
+
+        double value = 1;
+        size_t at = 0;
+        EXPECT_EQ(List_Find_Value(test_list, LIST_NUM_DOUBLE, &value, &at), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Find_Value(NULL, LIST_NUM_DOUBLE, &value, &at), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Find_Value(test_list, LIST_NUM_DOUBLE, NULL, &at), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Find_Value(test_list, LIST_NUM_DOUBLE, &value, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Find_Value(test_list, LIST_NUM_INT32, &value, &at), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Pipeline
+//{
+    //Tests a valid usage, filter then map then take collected into a new list
+    TEST(ListPipelineTest, ValidCollect) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[100];
+        for (int i = 0; i < 100; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_Pipeline_p pipeline = List_Pipeline_Create(test_list);
+        ASSERT_NE(pipeline, nullptr);
+        EXPECT_EQ(List_Pipeline_Filter(pipeline, is_even), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pipeline_Map(pipeline, double_int, free), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pipeline_Filter(pipeline, count_seen), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pipeline_Take(pipeline, 5), LIST_ERROR_SUCCESS);
+
+        seen_count = 0;
+        List_t* out_list = List_Pipeline_Collect(pipeline);
+        ASSERT_NE(out_list, nullptr);
+        EXPECT_EQ(List_Length(out_list), 5);
+        for (int i = 0; i < 5; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, out_list), 4 * i);
+        }
+        //the walk stopped as soon as the take was full
+        EXPECT_EQ(seen_count, 5);
+        //the source is untouched
+        EXPECT_EQ(List_Length(test_list), 100);
+        EXPECT_EQ(List_At(8, test_list), &test_vals[8]);
+
+        //running it again starts over
+        List_t* again_list = List_Pipeline_Collect(pipeline);
+        ASSERT_NE(again_list, nullptr);
+        EXPECT_EQ(List_Length(again_list), 5);
+
+        List_Destroy(again_list);
+        List_Destroy(out_list);
+        List_Pipeline_Destroy(pipeline);
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage, a map whose values need no freeing collects like any other
+    TEST(ListPipelineTest, ValidCollectNoFree) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[20];
+        for (int i = 0; i < 20; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_Pipeline_p pipeline = List_Pipeline_Create(test_list);
+        ASSERT_NE(pipeline, nullptr);
+        EXPECT_EQ(List_Pipeline_Map(pipeline, table_int, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pipeline_Filter(pipeline, is_even), LIST_ERROR_SUCCESS);
+
+        List_t* out_list = List_Pipeline_Collect(pipeline);
+        ASSERT_NE(out_list, nullptr);
+        EXPECT_EQ(List_Length(out_list), 10);
+        EXPECT_EQ(List_At(1, out_list), &test_table[2]);
+        EXPECT_EQ(List_At(6, out_list), &test_table[2]);
+        List_Delete_At(0, out_list);
+        EXPECT_EQ(List_Length(out_list), 9);
+
+        List_Destroy(out_list);
+        List_Pipeline_Destroy(pipeline);
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage, mapped values dropped by a filter or reduced are freed along the way
+    TEST(ListPipelineTest, ValidReduce) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[100];
+        for (int i = 0; i < 100; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_Pipeline_p pipeline = List_Pipeline_Create(test_list);
+        EXPECT_EQ(List_Pipeline_Map(pipeline, double_int, free), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pipeline_Map(pipeline, double_int, free), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pipeline_Filter(pipeline, is_not_255), LIST_ERROR_SUCCESS);
+
+        int accumulator = 0;
+        EXPECT_EQ(List_Pipeline_Reduce(pipeline, avg_reducer, &accumulator), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(accumulator, 4 * (99 * 100 / 2));
+
+        //a take of nothing reduces nothing
+        EXPECT_EQ(List_Pipeline_Take(pipeline, 0), LIST_ERROR_SUCCESS);
+        accumulator = 0;
+        EXPECT_EQ(List_Pipeline_Reduce(pipeline, avg_reducer, &accumulator), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(accumulator, 0);
+
+        List_Pipeline_Destroy(pipeline);
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage, without a map a sized list collects into a sized list
+    TEST(ListPipelineTest, ValidSized) {
+        List_t* test_list = List_Create_Deque_Sized(sizeof(int), 0, test_cmp_fnc);
+        for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_Pipeline_p pipeline = List_Pipeline_Create(test_list);
+        EXPECT_EQ(List_Pipeline_Filter(pipeline, is_even), LIST_ERROR_SUCCESS);
+        List_t* out_list = List_Pipeline_Collect(pipeline);
+        ASSERT_NE(out_list, nullptr);
+        EXPECT_EQ(List_Length(out_list), 5);
+        for (int i = 0; i < 5; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, out_list), 2 * i);
+            EXPECT_NE(List_At(i, out_list), List_At(2 * i, test_list));
+        }
+
+        List_Destroy(out_list);
+        List_Pipeline_Destroy(pipeline);
+        List_Destroy(test_list);
+    }
+    //Tests a map giving back NULL stops the pipeline without leaking what was mapped so far
+    TEST(ListPipelineTest, InvalidMap) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[] = {1, 2, 255, 3};
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_Pipeline_p pipeline = List_Pipeline_Create(test_list);
+        EXPECT_EQ(List_Pipeline_Map(pipeline, copy_unless_255, free), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pipeline_Collect(pipeline), nullptr);
+        int accumulator = 0;
+        EXPECT_EQ(List_Pipeline_Reduce(pipeline, avg_reducer, &accumulator), LIST_ERROR_BAD_ENTRY);
+
+        List_Pipeline_Destroy(pipeline);
+        List_Destroy(test_list);
+    }
+    //Test List pipeline with improper args
+    TEST(ListPipelineTest, InvalidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int accumulator = 0;
+
+        EXPECT_EQ(List_Pipeline_Create(NULL), nullptr);
+        EXPECT_EQ(List_Pipeline_Map(NULL, double_int, free), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pipeline_Filter(NULL, is_even), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pipeline_Take(NULL, 1), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pipeline_Reduce(NULL, avg_reducer, &accumulator), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pipeline_Collect(NULL), nullptr);
+
+        List_Pipeline_p pipeline = List_Pipeline_Create(test_list);
+        EXPECT_EQ(List_Pipeline_Map(pipeline, NULL, free), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pipeline_Filter(pipeline, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pipeline_Reduce(pipeline, NULL, &accumulator), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pipeline_Reduce(pipeline, avg_reducer, NULL), LIST_ERROR_INVALID_PARAM);
+        //only so many stages fit
+        for (int i = 0; i < 16; i++)
+        {
+            EXPECT_EQ(List_Pipeline_Take(pipeline, 1), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_Pipeline_Take(pipeline, 1), LIST_ERROR_EXCEED_LIMIT);
+
+        List_Pipeline_Destroy(pipeline);
+        List_Destroy(test_list);
+    }
+//}
+
 //List_Copy
 //{
     //Tests a valid usage
@@ -478,6 +1071,354 @@ int test_val3 = 63;
         EXPECT_EQ(List_Copy(NULL, NULL), nullptr);  
     }
 //}
+//List_Copy_Parallel
+//{
+    //Tests a valid usage
+    TEST(ListCopyParallelTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[100];
+        for (int i = 0; i < 100; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_t* test_list2 = List_Copy_Parallel(test_list, double_int, 4);
+
+        EXPECT_NE(test_list2, nullptr);
+        EXPECT_EQ(List_Length(test_list2), 100);
+        for (int i = 0; i < 100; i++)
+        {
+            int* copy_p = (int*)List_Shift(test_list2);
+            EXPECT_EQ(*copy_p, i * 2);
+            free(copy_p);
+        }
+
+        //shallow copies and picking the thread count should work too
+        List_t* test_list3 = List_Copy_Parallel(test_list, NULL, 0);
+        EXPECT_EQ(List_Length(test_list3), 100);
+        EXPECT_EQ(List_At(99, test_list3), &test_vals[99]);
+
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+        List_Destroy(test_list3);
+    }
+    //Tests a copy function failing part way
+    TEST(ListCopyParallelTest, FailedCopy) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, free);
+
+        for (int i = 0; i < 10; i++)
+        {
+            int* val_p = (int*)malloc(sizeof(int));
+            *val_p = (i == 5) ? 255 : i;
+            EXPECT_EQ(List_Push(val_p, test_list), LIST_ERROR_SUCCESS);
+        }
+
+        EXPECT_EQ(List_Copy_Parallel(test_list, copy_unless_255, 3), nullptr);
+        EXPECT_EQ(List_Copy(test_list, copy_unless_255), nullptr);
+        EXPECT_EQ(List_Length(test_list), 10); //make sure original is untouched
+
+        List_Destroy(test_list);
+    }
+    //Test List copy parallel with improper args
+    TEST(ListCopyParallelTest, InvalidArgs) {
+        EXPECT_EQ(List_Copy_Parallel(NULL, double_int, 2), nullptr);
+    }
+//}
+//List_Map
+//{
+    //Tests a valid usage
+    TEST(ListMapTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[100];
+        for (int i = 0; i < 100; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_t* test_list2 = List_Map(test_list, double_int, free);
+        EXPECT_NE(test_list2, nullptr);
+        EXPECT_EQ(List_Length(test_list2), 100);
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, test_list2), i * 2);
+        }
+        EXPECT_EQ(List_Length(test_list), 100); //make sure original is untouched
+        EXPECT_EQ(List_At(99, test_list), &test_vals[99]);
+
+        //the mapped list grows like any other
+        int* extra_p = (int*)double_int(&test_val1);
+        EXPECT_EQ(List_Push(extra_p, test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list2), 101);
+
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+    }
+    //Tests mapping inline values and an empty list
+    TEST(ListMapTest, SizedAndEmpty) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+        for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_t* test_list2 = List_Map(test_list, double_int, free);
+        EXPECT_EQ(List_Length(test_list2), 10);
+        EXPECT_EQ(*(int*)List_At(9, test_list2), 18);
+        List_Destroy(test_list2);
+
+        List_Purge(test_list);
+        test_list2 = List_Map(test_list, double_int, free);
+        EXPECT_NE(test_list2, nullptr);
+        EXPECT_EQ(List_Length(test_list2), 0);
+
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+    }
+    //Tests a valid parallel usage
+    TEST(ListMapTest, Parallel) {
+        List_t* test_list = List_Create_Deque(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[100];
+        for (int i = 0; i < 100; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_t* test_list2 = List_Map_Parallel(test_list, double_int, free, 4);
+        EXPECT_EQ(List_Length(test_list2), 100);
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, test_list2), i * 2);
+        }
+        List_Destroy(test_list2);
+
+        test_list2 = List_Map_Parallel(test_list, double_int, free, 0);
+        EXPECT_EQ(List_Length(test_list2), 100);
+
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+    }
+    //Tests a map function failing part way
+    TEST(ListMapTest, FailedMap) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        int test_vals[10];
+        for (int i = 0; i < 10; i++)
+        {
+            test_vals[i] = (i == 5) ? 255 : i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        EXPECT_EQ(List_Map(test_list, copy_unless_255, free), nullptr);
+        EXPECT_EQ(List_Map_Parallel(test_list, copy_unless_255, free, 3), nullptr);
+        EXPECT_EQ(List_Length(test_list), 10); //make sure original is untouched
+
+        List_Destroy(test_list);
+    }
+    //Test List map with improper args
+    TEST(ListMapTest, InvalidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Map(NULL, double_int, free), nullptr);
+        EXPECT_EQ(List_Map(test_list, NULL, free), nullptr);
+        EXPECT_EQ(List_Map(test_list, double_int, NULL), nullptr);
+        EXPECT_EQ(List_Map_Parallel(NULL, double_int, free, 2), nullptr);
+
+        List_Destroy(test_list);
+    }
+//}
+//List_Clone_COW
+//{
+    //Tests a valid usage
+    TEST(ListCloneCOWTest, ValidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+
+        List_t* test_list2 = List_Clone_COW(test_list);
+        List_t* test_list3 = List_Clone_COW(test_list2);
+        ASSERT_NE(test_list2, nullptr);
+        ASSERT_NE(test_list3, nullptr);
+        EXPECT_EQ(List_Length(test_list2), 3);
+        EXPECT_EQ(List_At(0, test_list2), &test_val1);
+        EXPECT_EQ(List_At(2, test_list3), &test_val3);
+
+        //writing to either side leaves the others alone
+        EXPECT_EQ(List_Push(&test_val1, test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pop(test_list), &test_val3);
+        EXPECT_EQ(List_Length(test_list), 2);
+        EXPECT_EQ(List_Length(test_list2), 4);
+        EXPECT_EQ(List_Length(test_list3), 3);
+        EXPECT_EQ(List_At(3, test_list2), &test_val1);
+        EXPECT_EQ(List_At(2, test_list3), &test_val3);
+
+        //the last one sharing just takes the storage over
+        EXPECT_EQ(List_Reverse(test_list3), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list3), &test_val3);
+        EXPECT_EQ(List_At(0, test_list2), &test_val1);
+
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+        List_Destroy(test_list3);
+    }
+    //Tests sized lists in every storage share their elements until written to
+    TEST(ListCloneCOWTest, SizedStorages) {
+        std::vector<int32_t> ints(100);
+        for (size_t i = 0; i < ints.size(); i++)
+        {
+            ints[i] = (int32_t)i;
+        }
+        for (int storage = 0; storage < 3; storage++)
+        {
+            List_t* test_list = num_list(storage, sizeof(int32_t), ints.data(), ints.size());
+            List_t* test_list2 = List_Clone_COW(test_list);
+            List_t* test_list3 = List_Clone_COW(test_list);
+            ASSERT_NE(test_list2, nullptr);
+            EXPECT_EQ(List_At(50, test_list2), List_At(50, test_list)); //nothing was copied
+            int64_t sum = 0;
+            EXPECT_EQ(List_Sum(test_list2, LIST_NUM_INT32, &sum), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(sum, 4950);
+
+            //writing in place copies first
+            EXPECT_EQ(List_For_Each(test_list2, half_int), LIST_ERROR_SUCCESS);
+            EXPECT_NE(List_At(50, test_list2), List_At(50, test_list));
+            EXPECT_EQ(*(int32_t*)List_At(50, test_list2), 25);
+            EXPECT_EQ(*(int32_t*)List_At(50, test_list), 50);
+            EXPECT_EQ(*(int32_t*)List_At(50, test_list3), 50);
+
+            EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(*(int32_t*)List_At(0, test_list), 0);
+            EXPECT_EQ(*(int32_t*)List_At(99, test_list3), 99);
+            int32_t out = 0;
+            EXPECT_EQ(List_Shift_Into(test_list3, &out), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(out, 0);
+            EXPECT_EQ(List_Length(test_list3), 99);
+            EXPECT_EQ(List_Length(test_list), 100);
+
+            List_Destroy(test_list);
+            List_Destroy(test_list2);
+            List_Destroy(test_list3);
+        }
+    }
+    //Tests purging, destroying and moving out of lists while they share
+    TEST(ListCloneCOWTest, Release) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[20];
+        for (int i = 0; i < 20; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+
+        List_t* test_list2 = List_Clone_COW(test_list);
+        List_Purge(test_list);
+        EXPECT_EQ(List_Length(test_list), 0);
+        EXPECT_EQ(List_Length(test_list2), 20);
+        EXPECT_EQ(List_At(19, test_list2), &test_vals[19]);
+
+        //concatenating a shared list empties it without touching its clone
+        List_t* test_list3 = List_Clone_COW(test_list2);
+        EXPECT_EQ(List_Concat(test_list, test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 20);
+        EXPECT_EQ(List_Length(test_list2), 0);
+        EXPECT_EQ(List_Length(test_list3), 20);
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+
+        List_t* test_list4 = List_Split(test_list3, 10);
+        EXPECT_EQ(List_Length(test_list3), 10);
+        EXPECT_EQ(List_At(0, test_list4), &test_vals[10]);
+
+        List_Destroy(test_list3);
+        List_Destroy(test_list4);
+    }
+    //Tests only the list cloned from frees values, whichever lists write, move and let go of them
+    TEST(ListCloneCOWTest, Ownership) {
+        for (int storage = 0; storage < 3; storage++)
+        {
+            List_t* test_list = (0 == storage) ? List_Create(0, test_cmp_fnc, counting_free_fnc)
+                : (1 == storage) ? List_Create_Compact(0, test_cmp_fnc, counting_free_fnc) : List_Create_Deque(0, test_cmp_fnc, counting_free_fnc);
+            for (int i = 0; i < 1000; i++)
+            {
+                int* val_p = (int*)malloc(sizeof(int));
+                *val_p = i;
+                EXPECT_EQ(List_Push(val_p, test_list), LIST_ERROR_SUCCESS);
+            }
+            freed_count = 0;
+
+            //a clone writing and letting go frees nothing, the list goes on freeing what it deletes
+            List_t* test_list2 = List_Clone_COW(test_list);
+            ASSERT_NE(test_list2, nullptr);
+            int extra = 1000;
+            EXPECT_EQ(List_Push(&extra, test_list2), LIST_ERROR_SUCCESS);
+            List_Delete_At(0, test_list2);
+            List_Destroy(test_list2);
+            EXPECT_EQ(freed_count, 0);
+            for (int i = 0; i < 500; i++)
+            {
+                List_Delete_At(0, test_list);
+            }
+            EXPECT_EQ(freed_count, 500);
+
+            //a value taken out of a shared list is the caller's, and so is a value moved out of a clone
+            test_list2 = List_Clone_COW(test_list);
+            int* val_p = (int*)List_Shift(test_list);
+            EXPECT_EQ(*val_p, 500);
+            free(val_p);
+            List_t* test_list3 = List_Clone_COW(test_list);
+            List_t* test_list4 = List_Split(test_list3, 400);
+            ASSERT_NE(test_list4, nullptr);
+            EXPECT_EQ(List_Length(test_list4), 99);
+            List_Destroy(test_list4);
+            List_Destroy(test_list3);
+            EXPECT_EQ(freed_count, 500);
+
+            //the list frees its values when it lets go, even while a clone still shares them
+            List_Destroy(test_list);
+            EXPECT_EQ(freed_count, 999);
+            List_Destroy(test_list2);
+            EXPECT_EQ(freed_count, 999);
+        }
+
+        //a buffer list keeps its values, its copy never frees them
+        alignas(max_align_t) unsigned char buf[1024];
+        List_t* test_list = List_Init_In_Buffer(buf, sizeof(buf), 8, test_cmp_fnc, free);
+        int* val_p = (int*)malloc(sizeof(int));
+        *val_p = 1;
+        EXPECT_EQ(List_Push(val_p, test_list), LIST_ERROR_SUCCESS);
+        List_t* test_list2 = List_Clone_COW(test_list);
+        ASSERT_NE(test_list2, nullptr);
+        int extra = 2;
+        EXPECT_EQ(List_Push(&extra, test_list2), LIST_ERROR_SUCCESS);
+        List_Destroy(test_list2);
+        EXPECT_EQ(*(int*)List_At(0, test_list), 1);
+        List_Destroy(test_list);
+    }
+    //Tests lists with nothing to share
+    TEST(ListCloneCOWTest, Unshareable) {
+        alignas(max_align_t) unsigned char buf[1024];
+        List_t* test_list = List_Init_In_Buffer(buf, sizeof(buf), 3, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Clone_COW(test_list);
+        EXPECT_EQ(List_Length(test_list2), 0);
+        List_Destroy(test_list2);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        test_list2 = List_Clone_COW(test_list);
+        EXPECT_EQ(List_At(0, test_list2), &test_val1);
+        EXPECT_EQ(List_Push(&test_val2, test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 1);
+
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+    }
+    //Test List clone with improper args
+    TEST(ListCloneCOWTest, InvalidArgs) {
+        EXPECT_EQ(List_Clone_COW(NULL), nullptr);
+    }
+//}
 //List_Some
 //{
     //Tests a valid usage
@@ -602,11 +1543,143 @@ int test_val3 = 63;
 
         List_Destroy(test_list);
     }
+    //Tests reversed lists in every storage read the other way through every operation
+    TEST(ListReverseTest, EveryStorage) {
+        std::vector<int> ints(40);
+        std::iota(ints.begin(), ints.end(), 0);
+        for (int storage = 0; storage < 3; storage++)
+        {
+            List_t* test_list = num_list(storage, sizeof(int), ints.data(), ints.size());
+            std::vector<int> vals(ints.rbegin(), ints.rend());
+            EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+            expect_ints(test_list, vals);
+
+            int val = 100;
+            EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+            vals.push_back(val++);
+            EXPECT_EQ(List_Unshift(&val, test_list), LIST_ERROR_SUCCESS);
+            vals.insert(vals.begin(), val++);
+            EXPECT_EQ(List_Insert(&val, 5, test_list), LIST_ERROR_SUCCESS);
+            vals.insert(vals.begin() + 5, val++);
+            int out = 0;
+            EXPECT_EQ(List_Pop_Into(test_list, &out), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(out, vals.back());
+            vals.pop_back();
+            EXPECT_EQ(List_Shift_Into(test_list, &out), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(out, vals.front());
+            vals.erase(vals.begin());
+            EXPECT_EQ(List_Remove_At_Into(10, test_list, &out), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(out, vals[10]);
+            vals.erase(vals.begin() + 10);
+            expect_ints(test_list, vals);
+
+            size_t at = 0;
+            EXPECT_EQ(List_Find_Value(test_list, LIST_NUM_INT32, &vals[7], &at), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(at, 7);
+
+            //copies and clones read the same way, and reversing a clone leaves the list alone
+            List_t* copy_list = List_Copy(test_list, NULL);
+            List_t* clone_list = List_Clone_COW(test_list);
+            expect_ints(copy_list, vals);
+            expect_ints(clone_list, vals);
+            EXPECT_EQ(List_Reverse(clone_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(*(int*)List_At(0, clone_list), vals.back());
+            EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+            vals.push_back(val++);
+            expect_ints(test_list, vals);
+            EXPECT_EQ(*(int*)List_At(0, clone_list), vals[vals.size() - 2]);
+
+            //moving nodes between lists lays a reversed one out the way it reads first
+            List_t* split_list = List_Split(test_list, 20);
+            std::vector<int> split_vals(vals.begin() + 20, vals.end());
+            vals.resize(20);
+            expect_ints(split_list, split_vals);
+            EXPECT_EQ(List_Reverse(split_list), LIST_ERROR_SUCCESS);
+            std::reverse(split_vals.begin(), split_vals.end());
+            EXPECT_EQ(List_Concat(test_list, split_list), LIST_ERROR_SUCCESS);
+            vals.insert(vals.end(), split_vals.begin(), split_vals.end());
+            expect_ints(test_list, vals);
+
+            //sorting keeps ties in the order the list reads
+            EXPECT_EQ(List_Sort(test_list, tens_cmp_fnc), LIST_ERROR_SUCCESS);
+            std::stable_sort(vals.begin(), vals.end(), [](int a, int b) { return a / 10 > b / 10; });
+            expect_ints(test_list, vals);
+
+            List_Destroy(test_list);
+            List_Destroy(copy_list);
+            List_Destroy(clone_list);
+            List_Destroy(split_list);
+        }
+    }
+    //Tests the sorts and filter of reversed lists
+    TEST(ListReverseTest, SortAndFilter) {
+        std::vector<int> ints(60);
+        std::iota(ints.begin(), ints.end(), 0);
+        for (int storage = 0; storage < 3; storage++)
+        {
+            std::vector<int> vals(ints.rbegin(), ints.rend());
+            std::vector<int> sorted(vals);
+            std::stable_sort(sorted.begin(), sorted.end(), [](int a, int b) { return a / 10 > b / 10; });
+
+            List_t* test_list = num_list(storage, sizeof(int), ints.data(), ints.size());
+            EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Sort_Concurrent(test_list, tens_cmp_fnc), LIST_ERROR_SUCCESS);
+            expect_ints(test_list, sorted);
+            List_Destroy(test_list);
+
+            test_list = num_list(storage, sizeof(int), ints.data(), ints.size());
+            EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Sort_By_Key(test_list, int_key, 4), LIST_ERROR_SUCCESS);
+            expect_ints(test_list, vals);
+            EXPECT_EQ(List_Filter(test_list, is_even), LIST_ERROR_SUCCESS);
+            std::vector<int> evens;
+            std::copy_if(vals.begin(), vals.end(), std::back_inserter(evens), [](int a) { return 0 == a % 2; });
+            expect_ints(test_list, evens);
+            List_Destroy(test_list);
+        }
+    }
     //Test List reverse with improper args
     TEST(ListReverseTest, InvalidArgs) {
         EXPECT_EQ(List_Reverse(NULL), LIST_ERROR_INVALID_PARAM);  
     }
 //}
+//List_Reverse_In_Place
+//{
+    //Tests a valid usage in every storage, reversed or not
+    TEST(ListReverseInPlaceTest, ValidArgs) {
+        std::vector<int> ints(30);
+        std::iota(ints.begin(), ints.end(), 0);
+        std::vector<int> reversed(ints.rbegin(), ints.rend());
+        for (int storage = 0; storage < 3; storage++)
+        {
+            List_t* test_list = num_list(storage, sizeof(int), ints.data(), ints.size());
+            EXPECT_EQ(List_Reverse_In_Place(test_list), LIST_ERROR_SUCCESS);
+            expect_ints(test_list, reversed);
+            EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+            expect_ints(test_list, ints);
+            EXPECT_EQ(List_Reverse_In_Place(test_list), LIST_ERROR_SUCCESS);
+            expect_ints(test_list, reversed);
+            List_Destroy(test_list);
+        }
+    }
+    //Tests heaps keep their order
+    TEST(ListReverseInPlaceTest, ValidHeap) {
+        List_t* test_list = List_Create_Heap_Sized(sizeof(int), 0, test_cmp_fnc);
+        for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Reverse_In_Place(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_Peek_Max(test_list), 9);
+        EXPECT_EQ(*(int*)List_At(0, test_list), 9);
+        List_Destroy(test_list);
+    }
+    //Test List reverse in place with improper args
+    TEST(ListReverseInPlaceTest, InvalidArgs) {
+        EXPECT_EQ(List_Reverse_In_Place(NULL), LIST_ERROR_INVALID_PARAM);
+    }
+//}
 //List_Filter
 //{
     //Tests a valid usage
@@ -696,44 +1769,320 @@ int test_val3 = 63;
         EXPECT_EQ(List_Sort(NULL, NULL), LIST_ERROR_INVALID_PARAM);
     }
 //}
-//List_For_Each
+//List_Sort_Concurrent
 //{
-    //Tests a valid usage
-    TEST(ListForEachTest, ValidArgs) {
-        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+    //Test List sort concurrent against List_Sort, which it should match exactly, ties included
+    TEST(ListSortConcurrentTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int vals[200];
+        for (int i = 0; i < 200; i++)
+        {
+            vals[i] = (i * 7919) % 31;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&vals[i], test_list2), LIST_ERROR_SUCCESS);
+        }
+
+        EXPECT_EQ(List_Sort_Concurrent(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Sort(test_list2, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 200);
+        for (size_t i = 0; i < 200; i++)
+        {
+            EXPECT_EQ(List_At(i, test_list), List_At(i, test_list2));
+        }
+        //already sorted is left alone
+        EXPECT_EQ(List_Sort_Concurrent(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), List_At(0, test_list2));
+        EXPECT_EQ(List_Push(&vals[0], test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 201);
 
+        List_Destroy(test_list);
+        List_Destroy(test_list2);
+    }
+    //Tests sized lists in every storage, with and without clones still sharing them
+    TEST(ListSortConcurrentTest, SizedStorages) {
+        std::vector<int32_t> ints(100);
+        for (size_t i = 0; i < ints.size(); i++)
+        {
+            ints[i] = (int32_t)((i * 37) % 100);
+        }
+        for (int storage = 0; storage < 3; storage++)
+        {
+            List_t* test_list = num_list(storage, sizeof(int32_t), ints.data(), ints.size());
+            List_t* test_list2 = num_list(storage, sizeof(int32_t), ints.data(), ints.size());
+            List_t* clone_list = List_Clone_COW(test_list2);
+
+            EXPECT_EQ(List_Sort_Concurrent(test_list, test_cmp_fnc), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Sort_Concurrent(test_list2, test_cmp_fnc), LIST_ERROR_SUCCESS);
+            for (size_t i = 0; i < 100; i++)
+            {
+                EXPECT_EQ(*(int32_t*)List_At(i, test_list), (int32_t)(99 - i));
+                EXPECT_EQ(*(int32_t*)List_At(i, test_list2), (int32_t)(99 - i));
+                EXPECT_EQ(*(int32_t*)List_At(i, clone_list), ints[i]);
+            }
+
+            List_Destroy(test_list);
+            List_Destroy(test_list2);
+            List_Destroy(clone_list);
+        }
+    }
+    //Tests lists written while they are sorted are sorted again, the last time under the lock
+    TEST(ListSortConcurrentTest, Written) {
+        std::vector<int> ints(50);
+        std::iota(ints.begin(), ints.end(), 0);
+        //every sort compares 0 and 1 first, the last write making it fall back to sorting under the lock
+        for (size_t writes = 1; writes <= 3; writes++)
+        {
+            write_list = num_list(0, sizeof(int), ints.data(), ints.size());
+            write_count = writes;
+            EXPECT_EQ(List_Sort_Concurrent(write_list, writing_cmp_fnc), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(write_count, 0);
+            ASSERT_EQ(List_Length(write_list), 50 + writes);
+            for (size_t i = 0; i < 50; i++)
+            {
+                EXPECT_EQ(*(int*)List_At(i, write_list), (int)(49 - i));
+            }
+            EXPECT_EQ(*(int*)List_At(50 + writes - 1, write_list), -1);
+            List_Destroy(write_list);
+        }
+        write_list = NULL;
+    }
+    //Tests a list written while it is sorted still frees its values, the one removed meanwhile freed once the sort returns
+    TEST(ListSortConcurrentTest, WrittenFreed) {
+        write_list = List_Create(0, test_cmp_fnc, counting_free_fnc);
+        for (int i = 0; i < 50; i++)
+        {
+            int* value = (int*)malloc(sizeof(int));
+            *value = i;
+            EXPECT_EQ(List_Push(value, write_list), LIST_ERROR_SUCCESS);
+        }
+        freed_count = 0;
+        write_count = 1;
+        EXPECT_EQ(List_Sort_Concurrent(write_list, removing_cmp_fnc), LIST_ERROR_SUCCESS);
+        ASSERT_NE(removed_p, nullptr);
+        EXPECT_EQ(*(int*)removed_p, 49);
+        counting_free_fnc(removed_p);
+        ASSERT_EQ(List_Length(write_list), 49);
+        for (size_t i = 0; i < 49; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, write_list), (int)(48 - i));
+        }
+        //an already sorted list is left as it was found
+        EXPECT_EQ(List_Sort_Concurrent(write_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(0, write_list), 48);
+        List_Delete_At(0, write_list);
+        EXPECT_EQ(freed_count, 2);
+        List_Destroy(write_list);
+        EXPECT_EQ(freed_count, 50);
+        write_list = NULL;
+        removed_p = NULL;
+    }
+    //Tests lists sorted under the lock instead
+    TEST(ListSortConcurrentTest, ValidFallback) {
+        List_t* test_list = List_Create(10, NULL, test_free_fnc);
+        EXPECT_EQ(List_Sort_Concurrent(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
         EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
         EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
-        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
-        EXPECT_EQ(List_Length(test_list), 3);
-
-        int old_val1 = test_val1;
-        int old_val2 = test_val2;
-        int old_val3 = test_val3;
+        EXPECT_EQ(List_Sort_Concurrent(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &test_val3);
+        EXPECT_EQ(List_Sort_Concurrent(test_list, test_cmp_fnc), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &test_val1);
+        List_Destroy(test_list);
 
-        EXPECT_EQ(List_For_Each(test_list,  half_int), LIST_ERROR_SUCCESS);
+        alignas(max_align_t) unsigned char buf[4096];
+        test_list = List_Init_In_Buffer(buf, sizeof(buf), 40, test_cmp_fnc, test_free_fnc);
+        int vals[40];
+        for (int i = 0; i < 40; i++)
+        {
+            vals[i] = i;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_Sort_Concurrent(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &vals[39]);
+        List_Destroy(test_list);
+    }
+    //Test List sort concurrent with improper args
+    TEST(ListSortConcurrentTest, InvalidArgs) {
+        EXPECT_EQ(List_Sort_Concurrent(NULL, NULL), LIST_ERROR_INVALID_PARAM);
+    }
+//}
+//List_Sort_By_Key
+//{
+    //Test List sort by key against List_Sort, which it should match exactly, ties included
+    TEST(ListSortByKeyTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        List_t* compact_list = List_Create_Compact(0, test_cmp_fnc, test_free_fnc);
+        List_t* deque_list = List_Create_Deque_Sized(sizeof(int), 0, test_cmp_fnc);
+        int vals[500];
+        for (int i = 0; i < 500; i++)
+        {
+            //a spread of small and large keys so several bytes differ
+            vals[i] = (i % 3) ? (i * 7919) % 997 : (i * 104729) % 70001;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&vals[i], compact_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&vals[i], deque_list), LIST_ERROR_SUCCESS);
+        }
+        List_t* sorted_list = List_Copy(test_list, NULL);
+        EXPECT_EQ(List_Sort(sorted_list, NULL), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Sort_By_Key(test_list, int_key, 4), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Sort_By_Key(compact_list, int_key, 8), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Sort_By_Key(deque_list, int_key, 4), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 500);
+        for (size_t i = 0; i < 500; i++)
+        {
+            EXPECT_EQ(List_At(i, test_list), List_At(i, sorted_list));
+            EXPECT_EQ(List_At(i, compact_list), List_At(i, sorted_list));
+            EXPECT_EQ(*(int*)List_At(i, deque_list), *(int*)List_At(i, sorted_list));
+        }
+        EXPECT_EQ(List_Pop(test_list), List_Pop(sorted_list));
+        EXPECT_EQ(List_Shift(test_list), List_Shift(sorted_list));
+
+        List_Destroy(sorted_list);
+        List_Destroy(deque_list);
+        List_Destroy(compact_list);
+        List_Destroy(test_list);
+    }
 
-        EXPECT_EQ(List_Length(test_list), 3);
-        EXPECT_EQ(*(int*)List_Pop(test_list), old_val3 / 2);
-        EXPECT_EQ(*(int*)List_Pop(test_list), old_val2 / 2);
-        EXPECT_EQ(*(int*)List_Pop(test_list), old_val1 / 2);
+    //Test List sort by key on small lists
+    TEST(ListSortByKeyTest, ValidSmall) {
+        List_t* test_list = List_Create(10, NULL, test_free_fnc);
+        EXPECT_EQ(List_Sort_By_Key(test_list, int_key, 4), LIST_ERROR_SUCCESS);
 
-        //reset for later just in case more tests need it
-        test_val1 = old_val1;
-        test_val2 = old_val2;
-        test_val2 = old_val3;
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Sort_By_Key(test_list, int_key, 4), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        //only the lowest byte differs, which is all a width of 1 looks at
+        EXPECT_EQ(List_Sort_By_Key(test_list, int_key, 1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Shift(test_list), &test_val1);
+        EXPECT_EQ(List_Shift(test_list), &test_val2);
+        EXPECT_EQ(List_Shift(test_list), &test_val3);
 
         List_Destroy(test_list);
     }
-    //Tests a valid usage
-    TEST(ListForEachTest, ValidEmpty) {
-        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
-
-        EXPECT_EQ(List_For_Each(test_list,  half_int), LIST_ERROR_SUCCESS);
 
+    //Test List sort by key with improper args
+    TEST(ListSortByKeyTest, InvalidArgs) {
+        List_t* test_list = List_Create(10, NULL, test_free_fnc);
+        EXPECT_EQ(List_Sort_By_Key(NULL, int_key, 4), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sort_By_Key(test_list, NULL, 4), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sort_By_Key(test_list, int_key, 0), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sort_By_Key(test_list, int_key, 9), LIST_ERROR_INVALID_PARAM);
         List_Destroy(test_list);
     }
-    //Test List for each with improper args
+//}
+//List_Sort_Decorated
+//{
+    //counts the keys built, each one the negated value so the sort comes out backwards
+    size_t keys_built = 0;
+    void* negated_key(const void* a)
+    {
+        keys_built++;
+        void* key = malloc(sizeof(int));
+        *(int*)key = -*(int*)a;
+        return key;
+    }
+
+    //Test List sort decorated builds one key per element and sorts stably by them
+    TEST(ListSortDecoratedTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        List_t* deque_list = List_Create_Deque_Sized(sizeof(int), 0, test_cmp_fnc);
+        int vals[200];
+        for (int i = 0; i < 200; i++)
+        {
+            vals[i] = (i * 31) % 53;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&vals[i], deque_list), LIST_ERROR_SUCCESS);
+        }
+        List_t* sorted_list = List_Copy(test_list, NULL);
+        EXPECT_EQ(List_Sort(sorted_list, NULL), LIST_ERROR_SUCCESS);
+
+        keys_built = 0;
+        EXPECT_EQ(List_Sort_Decorated(test_list, negated_key, test_cmp_fnc, free), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(keys_built, 200);
+        EXPECT_EQ(List_Sort_Decorated(deque_list, negated_key, test_cmp_fnc, free), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(keys_built, 400);
+        //least first, with equal values still in their original order
+        for (size_t i = 0; i < 200; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, test_list), *(int*)List_At(199 - i, sorted_list));
+            EXPECT_EQ(*(int*)List_At(i, deque_list), *(int*)List_At(199 - i, sorted_list));
+        }
+        for (size_t i = 1; i < 200; i++)
+        {
+            if (*(int*)List_At(i - 1, test_list) == *(int*)List_At(i, test_list))
+            {
+                EXPECT_LT((int*)List_At(i - 1, test_list), (int*)List_At(i, test_list));
+            }
+        }
+
+        List_Destroy(sorted_list);
+        List_Destroy(deque_list);
+        List_Destroy(test_list);
+    }
+
+    //Test List sort decorated leaves the list alone when a key cant be built
+    TEST(ListSortDecoratedTest, InvalidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Sort_Decorated(NULL, double_int, test_cmp_fnc, free), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sort_Decorated(test_list, NULL, test_cmp_fnc, free), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sort_Decorated(test_list, double_int, NULL, free), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Sort_Decorated(test_list, double_int, test_cmp_fnc, NULL), LIST_ERROR_INVALID_PARAM);
+
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Sort_Decorated(test_list, copy_unless_255, test_cmp_fnc, free), LIST_ERROR_BAD_ENTRY);
+        EXPECT_EQ(List_At(0, test_list), &test_val3);
+        EXPECT_EQ(List_At(1, test_list), &test_val2);
+        EXPECT_EQ(List_At(2, test_list), &test_val1);
+        EXPECT_EQ(List_Sort_Decorated(test_list, double_int, test_cmp_fnc, free), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &test_val1);
+        EXPECT_EQ(List_At(2, test_list), &test_val3);
+
+        List_Destroy(test_list);
+    }
+//}
+//List_For_Each
+//{
+    //Tests a valid usage
+    TEST(ListForEachTest, ValidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 3);
+
+        int old_val1 = test_val1;
+        int old_val2 = test_val2;
+        int old_val3 = test_val3;
+
+        EXPECT_EQ(List_For_Each(test_list,  half_int), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Length(test_list), 3);
+        EXPECT_EQ(*(int*)List_Pop(test_list), old_val3 / 2);
+        EXPECT_EQ(*(int*)List_Pop(test_list), old_val2 / 2);
+        EXPECT_EQ(*(int*)List_Pop(test_list), old_val1 / 2);
+
+        //reset for later just in case more tests need it
+        test_val1 = old_val1;
+        test_val2 = old_val2;
+        test_val2 = old_val3;
+
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage
+    TEST(ListForEachTest, ValidEmpty) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_For_Each(test_list,  half_int), LIST_ERROR_SUCCESS);
+
+        List_Destroy(test_list);
+    }
+    //Test List for each with improper args
     TEST(ListForEachTest, InvalidArgs) {
         List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
 
@@ -745,6 +2094,98 @@ int test_val3 = 63;
     }
 //}
 
+//List_For_Each_Chunk
+//{
+    //Tests a valid usage, chunks are full but for the last
+    TEST(ListForEachChunkTest, ValidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+        int expected = 0;
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+            expected += i;
+        }
+
+        struct chunk_sum acc = {0, 0, 0};
+        EXPECT_EQ(List_For_Each_Chunk(test_list, sum_chunk, 16, &acc), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(acc.sum, expected);
+        EXPECT_EQ(acc.chunks, 7);
+        EXPECT_EQ(acc.largest, 16);
+
+        //the default chunk size
+        acc = {0, 0, 0};
+        EXPECT_EQ(List_For_Each_Chunk(test_list, sum_chunk, 0, &acc), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(acc.sum, expected);
+        EXPECT_EQ(acc.chunks, 2);
+
+        //chunks larger than the stack buffer
+        acc = {0, 0, 0};
+        EXPECT_EQ(List_For_Each_Chunk(test_list, sum_chunk, 1000, &acc), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(acc.sum, expected);
+        EXPECT_EQ(acc.chunks, 1);
+        EXPECT_EQ(acc.largest, 100);
+
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage
+    TEST(ListForEachChunkTest, ValidEmpty) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        struct chunk_sum acc = {0, 0, 0};
+        EXPECT_EQ(List_For_Each_Chunk(test_list, sum_chunk, 8, &acc), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(acc.chunks, 0);
+
+        List_Destroy(test_list);
+    }
+    //Test List for each chunk with improper args
+    TEST(ListForEachChunkTest, InvalidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_For_Each_Chunk(NULL, NULL, 8, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_For_Each_Chunk(test_list, NULL, 8, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_For_Each_Chunk(NULL, sum_chunk, 8, NULL), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Some_Chunk
+//{
+    //Tests a valid usage
+    TEST(ListSomeChunkTest, ValidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+
+        int wanted = test_val2;
+        int* found = &wanted;
+        EXPECT_TRUE(List_Some_Chunk(test_list, chunk_has, 2, &found));
+        EXPECT_EQ(found, &test_val2);
+
+        wanted = 1;
+        found = &wanted;
+        EXPECT_FALSE(List_Some_Chunk(test_list, chunk_has, 2, &found));
+        EXPECT_EQ(found, &wanted);
+
+        List_Destroy(test_list);
+    }
+    //Test List some chunk with improper args
+    TEST(ListSomeChunkTest, InvalidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        int wanted = 1;
+        int* found = &wanted;
+
+        EXPECT_FALSE(List_Some_Chunk(NULL, NULL, 2, &found));
+        EXPECT_FALSE(List_Some_Chunk(test_list, NULL, 2, &found));
+        EXPECT_FALSE(List_Some_Chunk(NULL, chunk_has, 2, &found));
+        EXPECT_FALSE(List_Some_Chunk(test_list, chunk_has, 2, &found));
+
+        List_Destroy(test_list);
+    }
+//}
+
 //List_Iterator_Create
 //{
     //Tests a valid usage
@@ -809,6 +2250,112 @@ int test_val3 = 63;
     }
 //}
 
+//List_Iterator_Init
+//{
+    //Test an iterator in caller storage, both ways and copied by value
+    TEST(ListIteratorInit, ValidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        List_Push(&test_val1, test_list);
+        List_Push(&test_val2, test_list);
+        List_Push(&test_val3, test_list);
+
+        List_Iterator_Storage storage;
+        List_Iterator_p iter_p = List_Iterator_Init(&storage, test_list, false);
+        EXPECT_EQ((void*)iter_p, (void*)&storage);
+        EXPECT_EQ(List_Iterator_Next(iter_p), &test_val1);
+        EXPECT_EQ(List_Iterator_Next(iter_p), &test_val2);
+
+        List_Iterator_Storage copy_storage = storage;
+        EXPECT_EQ(List_Iterator_Curr((List_Iterator_p)&copy_storage), &test_val2);
+        EXPECT_EQ(List_Iterator_Next((List_Iterator_p)&copy_storage), &test_val3);
+        EXPECT_EQ(List_Iterator_Curr(iter_p), &test_val2);
+
+        //a heap copy of an iterator in caller storage is destroyed as usual
+        List_Iterator_p heap_iter_p = List_Iterator_Copy(iter_p);
+        EXPECT_EQ(List_Iterator_Next(heap_iter_p), &test_val3);
+        List_Iterator_Destroy(heap_iter_p);
+
+        iter_p = List_Iterator_Init(&storage, test_list, true);
+        EXPECT_EQ(List_Iterator_Next(iter_p), &test_val3);
+        EXPECT_EQ(List_Iterator_Next(iter_p), &test_val2);
+        //destroying is allowed but does nothing
+        List_Iterator_Destroy(iter_p);
+
+        List_Destroy(test_list);
+    }
+    //Test List iterator init with improper args
+    TEST(ListIteratorInit, InvalidArgs) {
+        List_Iterator_Storage storage;
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Iterator_Init(NULL, test_list, false), nullptr);
+        EXPECT_EQ(List_Iterator_Init(&storage, NULL, false), nullptr);
+        List_Destroy(test_list);
+    }
+//}
+
+//LIST_FOREACH
+//{
+    //Test foreach over every kind of storage
+    TEST(ListForeach, ValidArgs) {
+        List_t* lists[] = {
+            List_Create(0, test_cmp_fnc, test_free_fnc),
+            List_Create_Compact(0, test_cmp_fnc, test_free_fnc),
+            List_Create_Deque(0, test_cmp_fnc, test_free_fnc),
+        };
+        int vals[40];
+        for (List_t* test_list : lists)
+        {
+            for (int i = 0; i < 40; i++)
+            {
+                vals[i] = i;
+                EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+            }
+            int expected = 0;
+            LIST_FOREACH(test_list, item)
+            {
+                EXPECT_EQ(item, &vals[expected]);
+                expected++;
+            }
+            EXPECT_EQ(expected, 40);
+            List_Destroy(test_list);
+        }
+    }
+    //Test foreach unlocks the list when broken out of, and does nothing for empty or missing lists
+    TEST(ListForeach, ValidBreak) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+        int visited = 0;
+        LIST_FOREACH(test_list, item)
+        {
+            (void)item;
+            visited++;
+        }
+        LIST_FOREACH(NULL, item)
+        {
+            (void)item;
+            visited++;
+        }
+        EXPECT_EQ(visited, 0);
+
+        for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+        LIST_FOREACH(test_list, item)
+        {
+            if (5 == *(int*)item)
+            {
+                break;
+            }
+            visited++;
+        }
+        EXPECT_EQ(visited, 5);
+        //the list has to be unlocked again for this not to hang
+        EXPECT_EQ(List_Push(&visited, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 11);
+        List_Destroy(test_list);
+    }
+//}
+
 //List_Iterator_Copy
 //{
     //Tests a valid usage
@@ -998,4 +2545,1682 @@ int test_val3 = 63;
     TEST(ListIteratorDestroy, InvalidArgs) {
         List_Iterator_Destroy(NULL);
     }
-//}
\ No newline at end of file
+//}
+
+//List_Concat
+//{
+    //Tests a valid usage
+    TEST(ListConcatTest, ValidArgs) {
+        List_t* test_list1 = List_Create(10, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Concat(test_list1, test_list2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Length(test_list1), 3);
+        EXPECT_EQ(List_Length(test_list2), 0);
+        EXPECT_EQ(List_At(0, test_list1), &test_val1);
+        EXPECT_EQ(List_At(1, test_list1), &test_val2);
+        EXPECT_EQ(List_At(2, test_list1), &test_val3);
+
+        //both lists should still be usable
+        EXPECT_EQ(List_Push(&test_val1, test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pop(test_list1), &test_val1);
+        EXPECT_EQ(List_Push(&test_val1, test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pop(test_list2), &test_val1);
+
+        List_Destroy(test_list1);
+        List_Destroy(test_list2);
+    }
+    //Test List concat with improper args
+    TEST(ListConcatTest, InvalidArgs) {
+        List_t* test_list1 = List_Create(1, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Concat(NULL, test_list2), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Concat(test_list1, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Concat(test_list1, test_list1), LIST_ERROR_INVALID_PARAM);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Concat(test_list1, test_list2), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Length(test_list2), 1);
+
+        List_Destroy(test_list1);
+        List_Destroy(test_list2);
+    }
+//}
+
+//List_Splice
+//{
+    //Tests a valid usage
+    TEST(ListSpliceTest, ValidArgs) {
+        List_t* test_list1 = List_Create(10, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Create(10, test_cmp_fnc, test_free_fnc);
+        int test_vals[5] = {0, 1, 2, 3, 4};
+
+        EXPECT_EQ(List_Push(&test_vals[0], test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_vals[3], test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_vals[4], test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_vals[1], test_list2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_vals[2], test_list2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Splice(test_list1, 1, test_list2, 1, 2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Length(test_list1), 4);
+        EXPECT_EQ(List_Length(test_list2), 1);
+        for (size_t i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(List_At(i, test_list1), &test_vals[i]);
+        }
+        EXPECT_EQ(List_At(0, test_list2), &test_vals[4]);
+
+        //moving nothing is fine
+        EXPECT_EQ(List_Splice(test_list1, 4, test_list2, 1, 0), LIST_ERROR_SUCCESS);
+
+        List_Destroy(test_list1);
+        List_Destroy(test_list2);
+    }
+    //Test List splice with improper args
+    TEST(ListSpliceTest, InvalidArgs) {
+        List_t* test_list1 = List_Create(1, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Splice(NULL, 0, test_list2, 0, 1), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Splice(test_list1, 0, NULL, 0, 1), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Splice(test_list1, 0, test_list1, 0, 1), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Splice(test_list1, 2, test_list2, 0, 1), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Splice(test_list1, 0, test_list2, 0, 2), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Splice(test_list1, 0, test_list2, 0, 1), LIST_ERROR_EXCEED_LIMIT);
+
+        List_Destroy(test_list1);
+        List_Destroy(test_list2);
+    }
+//}
+
+//List_Split
+//{
+    //Tests a valid usage
+    TEST(ListSplitTest, ValidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+
+        List_t* split_list = List_Split(test_list, 1);
+
+        EXPECT_NE(split_list, nullptr);
+        EXPECT_EQ(List_Length(test_list), 1);
+        EXPECT_EQ(List_Length(split_list), 2);
+        EXPECT_EQ(List_Pop(test_list), &test_val1);
+        EXPECT_EQ(List_Pop(split_list), &test_val3);
+        EXPECT_EQ(List_Pop(split_list), &test_val2);
+
+        List_Destroy(split_list);
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage
+    TEST(ListSplitTest, ValidEnds) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+
+        List_t* split_list = List_Split(test_list, 1);
+        EXPECT_EQ(List_Length(split_list), 0);
+        List_Destroy(split_list);
+
+        split_list = List_Split(test_list, 0);
+        EXPECT_EQ(List_Length(test_list), 0);
+        EXPECT_EQ(List_Length(split_list), 1);
+        List_Destroy(split_list);
+
+        List_Destroy(test_list);
+    }
+    //Test List split with improper args
+    TEST(ListSplitTest, InvalidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Split(NULL, 0), nullptr);
+        EXPECT_EQ(List_Split(test_list, 1), nullptr);
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Transfer
+//{
+    //Tests a valid usage
+    TEST(ListTransferTest, ValidArgs) {
+        List_t* test_list1 = List_Create(10, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Transfer(test_list1, 1, test_list2, 0), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Length(test_list1), 1);
+        EXPECT_EQ(List_Length(test_list2), 2);
+        EXPECT_EQ(List_At(0, test_list2), &test_val2);
+        EXPECT_EQ(List_At(1, test_list2), &test_val3);
+
+        //moving within a list
+        EXPECT_EQ(List_Transfer(test_list2, 0, test_list2, 1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list2), &test_val3);
+        EXPECT_EQ(List_At(1, test_list2), &test_val2);
+
+        List_Destroy(test_list1);
+        List_Destroy(test_list2);
+    }
+    //Test List transfer with improper args
+    TEST(ListTransferTest, InvalidArgs) {
+        List_t* test_list1 = List_Create(10, test_cmp_fnc, test_free_fnc);
+        List_t* test_list2 = List_Create(1, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list2), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Transfer(NULL, 0, test_list2, 0), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Transfer(test_list1, 0, NULL, 0), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Transfer(test_list1, 1, test_list2, 0), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Transfer(test_list1, 0, test_list1, 1), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Transfer(test_list2, 0, test_list1, 2), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Transfer(test_list1, 0, test_list2, 0), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Length(test_list1), 1);
+
+        List_Destroy(test_list1);
+        List_Destroy(test_list2);
+    }
+//}
+
+//List_To_Array
+//{
+    //Tests a valid usage
+    TEST(ListToArrayTest, ValidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        void* test_array[3] = {NULL, NULL, NULL};
+        size_t length = 0;
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+
+        //caller buffer
+        EXPECT_EQ(List_To_Array(test_list, test_array, 3, &length), test_array);
+        EXPECT_EQ(length, 3);
+        EXPECT_EQ(test_array[0], &test_val1);
+        EXPECT_EQ(test_array[1], &test_val2);
+        EXPECT_EQ(test_array[2], &test_val3);
+
+        //library buffer
+        void** alloc_array = List_To_Array(test_list, NULL, 0, &length);
+        EXPECT_NE(alloc_array, nullptr);
+        EXPECT_EQ(length, 3);
+        EXPECT_EQ(alloc_array[2], &test_val3);
+        free(alloc_array);
+
+        List_Destroy(test_list);
+    }
+    //Test List to array with improper args
+    TEST(ListToArrayTest, InvalidArgs) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        void* test_array[1] = {NULL};
+        size_t length = 0;
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_To_Array(NULL, test_array, 1, &length), nullptr);
+        EXPECT_EQ(List_To_Array(test_list, test_array, 1, &length), nullptr);
+        EXPECT_EQ(length, 2); //still tells us how much room is needed
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_From_Array
+//{
+    //Tests a valid usage
+    TEST(ListFromArrayTest, ValidArgs) {
+        void* test_array[3] = {&test_val1, &test_val2, &test_val3};
+
+        List_t* test_list = List_From_Array(test_array, 3, 10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_NE(test_list, nullptr);
+        EXPECT_EQ(List_Length(test_list), 3);
+        EXPECT_EQ(List_At(0, test_list), &test_val1);
+        EXPECT_EQ(List_At(2, test_list), &test_val3);
+
+        //block nodes should behave like any other
+        EXPECT_EQ(List_Remove_At(1, test_list), &test_val2);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Pop(test_list), &test_val2);
+        EXPECT_EQ(List_Pop(test_list), &test_val3);
+
+        List_Destroy(test_list);
+
+        //empty arrays give empty lists
+        test_list = List_From_Array(NULL, 0, 10, test_cmp_fnc, test_free_fnc);
+        EXPECT_NE(test_list, nullptr);
+        EXPECT_EQ(List_Length(test_list), 0);
+        List_Destroy(test_list);
+    }
+    //Test List from array with improper args
+    TEST(ListFromArrayTest, InvalidArgs) {
+        void* test_array[3] = {&test_val1, NULL, &test_val3};
+
+        EXPECT_EQ(List_From_Array(NULL, 3, 10, test_cmp_fnc, test_free_fnc), nullptr);
+        EXPECT_EQ(List_From_Array(test_array, 3, 10, test_cmp_fnc, test_free_fnc), nullptr);
+        EXPECT_EQ(List_From_Array(test_array, 1, 10, test_cmp_fnc, NULL), nullptr);
+        EXPECT_EQ(List_From_Array(test_array, 3, 2, test_cmp_fnc, test_free_fnc), nullptr);
+    }
+//}
+
+//List_Compact
+//{
+    //Tests a valid usage
+    TEST(ListCompactTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[100];
+        for (int i = 0; i < 100; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Unshift(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_Remove_At(50, test_list), &test_vals[49]);
+
+        EXPECT_EQ(List_Compact(test_list), LIST_ERROR_SUCCESS);
+
+        //order and length must survive
+        EXPECT_EQ(List_Length(test_list), 99);
+        EXPECT_EQ(List_At(0, test_list), &test_vals[99]);
+        EXPECT_EQ(List_At(50, test_list), &test_vals[48]);
+        EXPECT_EQ(List_Pop(test_list), &test_vals[0]);
+        EXPECT_EQ(List_Push(&test_vals[0], test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(98, test_list), &test_vals[0]);
+
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage
+    TEST(ListCompactTest, ValidEmpty) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Compact(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 0);
+
+        List_Destroy(test_list);
+    }
+    //Test List compact with improper args
+    TEST(ListCompactTest, InvalidArgs) {
+        EXPECT_EQ(List_Compact(NULL), LIST_ERROR_INVALID_PARAM);
+    }
+//}
+
+//List_Set_Compact_Threshold
+//{
+    //Tests a valid usage
+    TEST(ListSetCompactThresholdTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[1000];
+
+        EXPECT_EQ(List_Set_Compact_Threshold(test_list, 25), LIST_ERROR_SUCCESS);
+        for (int i = 0; i < 1000; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+            //churn the front to trigger a few compactions along the way
+            if (0 == i % 3)
+            {
+                EXPECT_EQ(List_Unshift(List_Shift(test_list), test_list), LIST_ERROR_SUCCESS);
+            }
+        }
+
+        EXPECT_EQ(List_Length(test_list), 1000);
+        for (int i = 0; i < 1000; i++)
+        {
+            EXPECT_EQ(List_Shift(test_list), &test_vals[i]);
+        }
+
+        EXPECT_EQ(List_Set_Compact_Threshold(test_list, 0), LIST_ERROR_SUCCESS);
+
+        List_Destroy(test_list);
+    }
+    //Tests pointers to the elements of a sized list stay good through churn, only List_Compact moving them
+    TEST(ListSetCompactThresholdTest, SizedPointers) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+        EXPECT_EQ(List_Set_Compact_Threshold(test_list, 1), LIST_ERROR_SUCCESS);
+        for (int i = 0; i < 1000; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+        int* last_p = (int*)List_At(999, test_list);
+        for (int i = 0; i < 500; i++)
+        {
+            EXPECT_EQ(List_Shift_Into(test_list, NULL), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Unshift(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_At(999, test_list), last_p);
+        EXPECT_EQ(*last_p, 999);
+
+        EXPECT_EQ(List_Compact(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(999, test_list), 999);
+
+        List_Destroy(test_list);
+    }
+    //Test List set compact threshold with improper args
+    TEST(ListSetCompactThresholdTest, InvalidArgs) {
+        EXPECT_EQ(List_Set_Compact_Threshold(NULL, 10), LIST_ERROR_INVALID_PARAM);
+    }
+//}
+//List_Set_Prefetch_Distance
+//{
+    //Tests a valid usage, every scan gives the same answers however far ahead it fetches
+    TEST(ListSetPrefetchDistanceTest, ValidArgs) {
+        int test_vals[1000];
+        for (int i = 0; i < 1000; i++)
+        {
+            test_vals[i] = i;
+        }
+        List_t* test_lists[] = {List_Create(0, test_cmp_fnc, test_free_fnc), List_Create_Compact(0, test_cmp_fnc, test_free_fnc),
+            List_Create_Deque(0, test_cmp_fnc, test_free_fnc), List_Create_Sized(sizeof(int), 0, test_cmp_fnc)};
+        for (List_t* test_list : test_lists)
+        {
+            for (int i = 0; i < 1000; i++)
+            {
+                EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+            }
+            for (size_t distance : {0, 1, 7, 256})
+            {
+                EXPECT_EQ(List_Set_Prefetch_Distance(test_list, distance), LIST_ERROR_SUCCESS);
+
+                size_t at = 0;
+                EXPECT_EQ(List_Find(&test_vals[999], test_list, &at), LIST_ERROR_SUCCESS);
+                EXPECT_EQ(at, 999);
+                int accumulator = 0;
+                EXPECT_EQ(List_Reduce(test_list, avg_reducer, &accumulator), LIST_ERROR_SUCCESS);
+                EXPECT_EQ(accumulator, 999 * 1000 / 2);
+                EXPECT_FALSE(List_Every(test_list, is_not_255));
+                EXPECT_EQ(List_Verify(test_list, NULL), LIST_ERROR_SUCCESS);
+
+                List_t* copy_list = List_Copy(test_list, NULL);
+                ASSERT_NE(copy_list, nullptr);
+                EXPECT_EQ(List_Length(copy_list), 1000);
+                EXPECT_EQ(*(int*)List_At(500, copy_list), 500);
+                List_Destroy(copy_list);
+            }
+            List_Destroy(test_list);
+        }
+    }
+    //Tests the walk stays within each thread's share of a parallel copy
+    TEST(ListSetPrefetchDistanceTest, ValidParallelCopy) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int test_vals[1000];
+        for (int i = 0; i < 1000; i++)
+        {
+            test_vals[i] = i;
+            EXPECT_EQ(List_Push(&test_vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_Set_Prefetch_Distance(test_list, 64), LIST_ERROR_SUCCESS);
+
+        List_t* copy_list = List_Copy_Parallel(test_list, double_int, 4);
+        ASSERT_NE(copy_list, nullptr);
+        for (int i = 0; i < 1000; i++)
+        {
+            int* copy_p = (int*)List_Shift(copy_list);
+            EXPECT_EQ(*copy_p, i * 2);
+            free(copy_p);
+        }
+
+        List_Destroy(copy_list);
+        List_Destroy(test_list);
+    }
+    //Test List set prefetch distance with improper args
+    TEST(ListSetPrefetchDistanceTest, InvalidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Set_Prefetch_Distance(NULL, 8), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Set_Prefetch_Distance(test_list, 257), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(test_list);
+    }
+//}
+//List_Create_Sized
+//{
+    //Tests a valid usage
+    TEST(ListCreateSizedTest, ValidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        ASSERT_NE(test_list, nullptr);
+
+        int val = test_val2;
+        EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+        val = test_val1;
+        EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+        val = test_val3;
+        EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+
+        //the elements are copies held by the list
+        EXPECT_NE(List_At(0, test_list), &val);
+        EXPECT_EQ(*(int*)List_At(0, test_list), test_val2);
+        EXPECT_EQ(*(int*)List_At(2, test_list), test_val3);
+
+        EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(0, test_list), test_val1);
+        EXPECT_EQ(*(int*)List_At(2, test_list), test_val3);
+
+        EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(0, test_list), test_val3);
+
+        List_t* copy_list = List_Copy(test_list, NULL);
+        ASSERT_NE(copy_list, nullptr);
+        EXPECT_EQ(List_Length(copy_list), 3);
+        EXPECT_NE(List_At(1, copy_list), List_At(1, test_list));
+        EXPECT_EQ(*(int*)List_At(1, copy_list), test_val2);
+
+        //plain removal has no pointer to give back
+        EXPECT_EQ(List_Pop(test_list), nullptr);
+
+        List_Destroy(copy_list);
+        List_Destroy(test_list);
+    }
+    //Test List create sized with improper args
+    TEST(ListCreateSizedTest, InvalidArgs) {
+        EXPECT_EQ(List_Create_Sized(0, 10, test_cmp_fnc), nullptr);
+
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        List_t* other_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Push(&test_val1, other_list), LIST_ERROR_SUCCESS);
+
+        //nodes can not move between lists of different element sizes
+        EXPECT_EQ(List_Concat(test_list, other_list), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Splice(test_list, 0, other_list, 0, 1), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Transfer(other_list, 0, test_list, 0), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Length(other_list), 1);
+
+        List_Destroy(other_list);
+        List_Destroy(test_list);
+    }
+//}
+//List_Remove_At_Into
+//{
+    //Tests a valid usage
+    TEST(ListRemoveAtIntoTest, ValidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        int val = 0;
+
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+
+        EXPECT_EQ(List_Remove_At_Into(1, test_list, &val), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(val, 1);
+        EXPECT_EQ(List_Remove_At_Into(0, test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 2);
+        EXPECT_EQ(*(int*)List_At(0, test_list), 2);
+
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage on a list of pointers
+    TEST(ListRemoveAtIntoTest, ValidPointers) {
+        List_t* test_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+        void* out_p = NULL;
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Remove_At_Into(0, test_list, &out_p), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(out_p, &test_val1);
+
+        List_Destroy(test_list);
+    }
+    //Test List remove at into with improper args
+    TEST(ListRemoveAtIntoTest, InvalidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        int val = 0;
+
+        EXPECT_EQ(List_Remove_At_Into(0, NULL, &val), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Remove_At_Into(0, test_list, &val), LIST_ERROR_INVALID_PARAM); //empty list
+        EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Remove_At_Into(1, test_list, &val), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(test_list);
+    }
+//}
+//List_Pop_Into/List_Shift_Into
+//{
+    //Tests a valid usage
+    TEST(ListPopIntoTest, ValidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        int val = 0;
+
+        for (int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+
+        EXPECT_EQ(List_Pop_Into(test_list, &val), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(val, 2);
+        EXPECT_EQ(List_Length(test_list), 2);
+
+        List_Destroy(test_list);
+    }
+    //Test List pop into with improper args
+    TEST(ListPopIntoTest, InvalidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        int val = 0;
+
+        EXPECT_EQ(List_Pop_Into(NULL, &val), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Pop_Into(test_list, &val), LIST_ERROR_INVALID_PARAM); //empty list
+
+        List_Destroy(test_list);
+    }
+    //Tests a valid usage
+    TEST(ListShiftIntoTest, ValidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        int val = 0;
+
+        for (int i = 0; i < 3; i++)
+        {
+            EXPECT_EQ(List_Push(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+
+        EXPECT_EQ(List_Shift_Into(test_list, &val), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(val, 0);
+        EXPECT_EQ(*(int*)List_At(0, test_list), 1);
+
+        List_Destroy(test_list);
+    }
+    //Test List shift into with improper args
+    TEST(ListShiftIntoTest, InvalidArgs) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 10, test_cmp_fnc);
+        int val = 0;
+
+        EXPECT_EQ(List_Shift_Into(NULL, &val), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Shift_Into(test_list, &val), LIST_ERROR_INVALID_PARAM); //empty list
+
+        List_Destroy(test_list);
+    }
+//}
+//List_Create_Compact
+//{
+    //Tests a valid usage
+    TEST(ListCreateCompactTest, ValidArgs) {
+        List_t* test_list = List_Create_Compact(10, test_cmp_fnc, test_free_fnc);
+        ASSERT_NE(test_list, nullptr);
+
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Unshift(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 3);
+        EXPECT_EQ(List_At(0, test_list), &test_val1);
+        EXPECT_EQ(List_At(2, test_list), &test_val3);
+
+        size_t found = 0;
+        EXPECT_EQ(List_Find(&test_val3, test_list, &found), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(found, 2);
+
+        EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &test_val3);
+        EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &test_val1);
+        EXPECT_EQ(List_At(2, test_list), &test_val3);
+
+        List_Iterator_p iter_p = List_Iterator_Create_Reverse(test_list);
+        EXPECT_EQ(List_Iterator_Next(iter_p), &test_val3);
+        EXPECT_EQ(List_Iterator_Next(iter_p), &test_val2);
+        EXPECT_EQ(List_Iterator_Prev(iter_p), &test_val3);
+        List_Iterator_Destroy(iter_p);
+
+        //removed slots are reused
+        EXPECT_EQ(List_Remove_At(1, test_list), &test_val2);
+        EXPECT_EQ(List_Insert(&test_val2, 0, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &test_val2);
+        EXPECT_EQ(List_Filter(test_list, is_not_255), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 2);
+        EXPECT_EQ(List_Shift(test_list), &test_val2);
+        EXPECT_EQ(List_Pop(test_list), &test_val3);
+        EXPECT_EQ(List_Pop(test_list), nullptr);
+
+        List_Destroy(test_list);
+    }
+    //Tests growing well past the first allocation and compacting
+    TEST(ListCreateCompactTest, ValidSized) {
+        List_t* test_list = List_Create_Compact_Sized(sizeof(int), 0, test_cmp_fnc);
+        ASSERT_NE(test_list, nullptr);
+
+        for (int i = 0; i < 1000; i++)
+        {
+            EXPECT_EQ(List_Unshift(&i, test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(*(int*)List_At(0, test_list), 999);
+        for (int i = 0; i < 500; i++)
+        {
+            List_Delete_At(i, test_list);
+        }
+        EXPECT_EQ(List_Length(test_list), 500);
+        EXPECT_EQ(List_Compact(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(0, test_list), 998);
+        EXPECT_EQ(*(int*)List_At(499, test_list), 0);
+
+        EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+        int val = 0;
+        EXPECT_EQ(List_Shift_Into(test_list, &val), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(val, 998);
+        EXPECT_EQ(List_Pop_Into(test_list, &val), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(val, 0);
+
+        List_t* copy_list = List_Copy(test_list, NULL);
+        ASSERT_NE(copy_list, nullptr);
+        EXPECT_EQ(List_Length(copy_list), 498);
+        EXPECT_EQ(*(int*)List_At(0, copy_list), 996);
+
+        List_Purge(test_list);
+        EXPECT_EQ(List_Length(test_list), 0);
+        EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+
+        List_Destroy(copy_list);
+        List_Destroy(test_list);
+    }
+    //Tests moving elements between compact and node lists
+    TEST(ListCreateCompactTest, ValidMoves) {
+        List_t* compact_list = List_Create_Compact(10, test_cmp_fnc, test_free_fnc);
+        List_t* node_list = List_Create(10, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, compact_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, compact_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, node_list), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Concat(node_list, compact_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(compact_list), 0);
+        EXPECT_EQ(List_Length(node_list), 3);
+        EXPECT_EQ(List_At(2, node_list), &test_val2);
+
+        EXPECT_EQ(List_Splice(compact_list, 0, node_list, 1, 2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(node_list), 1);
+        EXPECT_EQ(List_At(0, compact_list), &test_val1);
+
+        EXPECT_EQ(List_Transfer(node_list, 0, compact_list, 1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(1, compact_list), &test_val3);
+        EXPECT_EQ(List_Transfer(compact_list, 0, compact_list, 2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(2, compact_list), &test_val1);
+
+        List_t* split_list = List_Split(compact_list, 1);
+        ASSERT_NE(split_list, nullptr);
+        EXPECT_EQ(List_Length(compact_list), 1);
+        EXPECT_EQ(List_At(0, compact_list), &test_val3);
+        EXPECT_EQ(List_At(1, split_list), &test_val1);
+
+        List_Destroy(split_list);
+        List_Destroy(node_list);
+        List_Destroy(compact_list);
+    }
+    //Tests that a failed deep copy leaves nothing behind
+    TEST(ListCreateCompactTest, FailedCopy) {
+        List_t* test_list = List_Create_Compact(10, test_cmp_fnc, free);
+
+        EXPECT_EQ(List_Push(double_int(&test_val2), test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(double_int(&test_val3), test_list), LIST_ERROR_SUCCESS);
+        List_t* copy_list = List_Copy(test_list, double_int);
+        ASSERT_NE(copy_list, nullptr);
+        EXPECT_EQ(*(int*)List_At(1, copy_list), test_val3 * 4);
+
+        int* bad_val = (int*)malloc(sizeof(int));
+        *bad_val = 255;
+        EXPECT_EQ(List_Push(bad_val, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Copy(test_list, copy_unless_255), nullptr);
+
+        List_Destroy(copy_list);
+        List_Destroy(test_list);
+    }
+    //Test List create compact with improper args
+    TEST(ListCreateCompactTest, InvalidArgs) {
+        EXPECT_EQ(List_Create_Compact(10, test_cmp_fnc, NULL), nullptr);
+        EXPECT_EQ(List_Create_Compact_Sized(0, 10, test_cmp_fnc), nullptr);
+
+        List_t* test_list = List_Create_Compact(2, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Insert(&test_val3, 5, test_list), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_At(2, test_list), nullptr);
+
+        List_t* sized_list = List_Create_Compact_Sized(sizeof(int), 10, test_cmp_fnc);
+        EXPECT_EQ(List_Concat(sized_list, test_list), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(sized_list);
+        List_Destroy(test_list);
+    }
+//}
+
+//Small lists
+//{
+    //Test that nodes are reused and the list keeps working past its first few nodes
+    TEST(ListPoolTest, ValidGrowth) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int vals[20];
+
+        for (int round = 0; round < 3; round++)
+        {
+            for (int i = 0; i < 20; i++)
+            {
+                vals[i] = i;
+                EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+            }
+            EXPECT_EQ(List_Length(test_list), 20);
+            EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+            for (int i = 0; i < 20; i++)
+            {
+                EXPECT_EQ(*(int*)List_Pop(test_list), i);
+            }
+            EXPECT_EQ(List_Length(test_list), 0);
+        }
+
+        List_Destroy(test_list);
+    }
+    //Test that nodes moved out of a small list outlive it
+    TEST(ListPoolTest, ValidMoves) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        List_t* other_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Transfer(test_list, 0, other_list, 0), LIST_ERROR_SUCCESS);
+        List_t* split_list = List_Split(test_list, 1);
+        ASSERT_NE(split_list, nullptr);
+        EXPECT_EQ(List_Concat(other_list, test_list), LIST_ERROR_SUCCESS);
+        List_Destroy(test_list);
+
+        EXPECT_EQ(List_Length(other_list), 2);
+        EXPECT_EQ(List_At(0, other_list), &test_val1);
+        EXPECT_EQ(List_At(1, other_list), &test_val2);
+        EXPECT_EQ(List_At(0, split_list), &test_val3);
+
+        //the emptied pool is handed out again
+        EXPECT_EQ(List_Push(&test_val1, split_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Splice(other_list, 2, split_list, 0, 2), LIST_ERROR_SUCCESS);
+        List_Destroy(split_list);
+        EXPECT_EQ(List_Length(other_list), 4);
+        EXPECT_EQ(List_At(2, other_list), &test_val3);
+        EXPECT_EQ(List_At(3, other_list), &test_val1);
+
+        List_Destroy(other_list);
+    }
+    //Test that moving elements back and forth between small lists never allocates
+    TEST(ListPoolTest, ValidMovesNoAlloc) {
+#ifdef TEST_NO_ALLOC_COUNT
+        GTEST_SKIP() << "allocations cant be counted in this build";
+#endif
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        List_t* other_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        int vals[4] = {0, 1, 2, 3};
+
+        for (int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+        size_t allocs = alloc_count;
+        for (int i = 0; i < 1000; i++)
+        {
+            EXPECT_EQ(List_Transfer(test_list, 0, other_list, 0), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(List_Shift(other_list), test_list), LIST_ERROR_SUCCESS);
+        }
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(List_Splice(other_list, 0, test_list, 1, 2), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Concat(test_list, other_list), LIST_ERROR_SUCCESS);
+        }
+        List_t* split_list = List_Split(test_list, 2);
+        ASSERT_NE(split_list, nullptr);
+        allocs++;
+        EXPECT_EQ(List_Concat(other_list, split_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(alloc_count, allocs);
+        List_Destroy(split_list);
+
+        EXPECT_EQ(List_Length(test_list), 2);
+        EXPECT_EQ(List_Length(other_list), 2);
+        EXPECT_EQ(*(int*)List_At(0, test_list) + *(int*)List_At(1, test_list)
+            + *(int*)List_At(0, other_list) + *(int*)List_At(1, other_list), 6);
+
+        List_Destroy(test_list);
+        List_Destroy(other_list);
+    }
+    //Test small lists holding their elements inline
+    TEST(ListPoolTest, ValidSized) {
+        List_t* test_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        List_t* copy_list = List_Copy(test_list, NULL);
+        ASSERT_NE(copy_list, nullptr);
+        List_t* split_list = List_Split(test_list, 0);
+        ASSERT_NE(split_list, nullptr);
+        List_Destroy(test_list);
+
+        EXPECT_EQ(*(int*)List_At(1, split_list), test_val2);
+        EXPECT_EQ(*(int*)List_At(0, copy_list), test_val1);
+        EXPECT_EQ(List_Concat(copy_list, split_list), LIST_ERROR_SUCCESS);
+        List_Destroy(split_list);
+        EXPECT_EQ(List_Length(copy_list), 4);
+        EXPECT_EQ(*(int*)List_At(3, copy_list), test_val2);
+
+        List_Destroy(copy_list);
+    }
+//}
+
+//List_Init_In_Buffer
+//{
+    //Test List init in buffer with valid args
+    TEST(ListInitInBufferTest, ValidArgs) {
+        alignas(max_align_t) unsigned char buf[1024];
+        ASSERT_LE(List_Buffer_Size(4), sizeof(buf));
+        //an unaligned start is fine as long as the size allows for it
+        List_t* test_list = List_Init_In_Buffer(buf + 1, List_Buffer_Size(4), 4, test_cmp_fnc, test_free_fnc);
+        ASSERT_NE(test_list, nullptr);
+
+        for (int round = 0; round < 3; round++)
+        {
+            EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Unshift(&test_val1, test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_EXCEED_LIMIT);
+            EXPECT_EQ(List_Length(test_list), 4);
+            EXPECT_EQ(List_At(0, test_list), &test_val1);
+            EXPECT_EQ(List_At(1, test_list), &test_val3);
+            EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Pop(test_list), &test_val3);
+            EXPECT_EQ(List_Shift(test_list), &test_val1);
+            EXPECT_EQ(List_Compact(test_list), LIST_ERROR_SUCCESS);
+            List_Purge(test_list);
+        }
+
+        List_Destroy(test_list);
+    }
+    //Test moving elements in and out of a buffer list
+    TEST(ListInitInBufferTest, ValidMoves) {
+        alignas(max_align_t) unsigned char buf[1024];
+        List_t* test_list = List_Init_In_Buffer(buf, sizeof(buf), 3, test_cmp_fnc, test_free_fnc);
+        List_t* other_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        ASSERT_NE(test_list, nullptr);
+
+        EXPECT_EQ(List_Push(&test_val1, other_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, other_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Concat(test_list, other_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, other_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Transfer(other_list, 0, test_list, 1), LIST_ERROR_SUCCESS);
+        List_Destroy(other_list);
+        EXPECT_EQ(List_At(1, test_list), &test_val3);
+        EXPECT_EQ(List_Transfer(test_list, 0, test_list, 2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(2, test_list), &test_val1);
+
+        //lists split off are ordinary lists
+        List_t* split_list = List_Split(test_list, 1);
+        ASSERT_NE(split_list, nullptr);
+        EXPECT_EQ(List_Length(test_list), 1);
+        List_Destroy(test_list);
+        EXPECT_EQ(List_Length(split_list), 2);
+        EXPECT_EQ(List_At(0, split_list), &test_val2);
+        EXPECT_EQ(List_Push(&test_val1, split_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val1, split_list), LIST_ERROR_EXCEED_LIMIT);
+
+        List_Destroy(split_list);
+    }
+    //Test that moving elements out of a buffer list copies them rather than taking the buffer's nodes along
+    TEST(ListInitInBufferTest, ValidMovesOut) {
+#ifdef TEST_NO_ALLOC_COUNT
+        GTEST_SKIP() << "allocations cant be counted in this build";
+#endif
+        static unsigned char buf[65536];
+        ASSERT_LE(List_Buffer_Size(1000), sizeof(buf));
+        List_t* test_list = List_Init_In_Buffer(buf, sizeof(buf), 1000, test_cmp_fnc, test_free_fnc);
+        List_t* other_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        ASSERT_NE(test_list, nullptr);
+        int vals[1000];
+
+        for (int i = 0; i < 1000; i++)
+        {
+            vals[i] = i;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+        size_t allocs = alloc_count;
+        EXPECT_EQ(List_Transfer(test_list, 0, other_list, 0), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Splice(other_list, 1, test_list, 0, 2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(alloc_count, allocs);
+        List_t* split_list = List_Split(test_list, 994);
+        ASSERT_NE(split_list, nullptr);
+        EXPECT_EQ(alloc_count, allocs + 1);
+
+        //the buffer list still has every node it started with
+        EXPECT_EQ(List_Length(test_list), 994);
+        EXPECT_EQ(List_At(0, test_list), &vals[3]);
+        EXPECT_EQ(List_At(0, other_list), &vals[0]);
+        EXPECT_EQ(List_At(2, other_list), &vals[2]);
+        EXPECT_EQ(List_At(0, split_list), &vals[997]);
+        allocs = alloc_count;
+        EXPECT_EQ(List_Concat(test_list, other_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Concat(test_list, split_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(alloc_count, allocs);
+        EXPECT_EQ(List_Length(test_list), 1000);
+        EXPECT_EQ(List_Push(&vals[0], test_list), LIST_ERROR_EXCEED_LIMIT);
+
+        List_Destroy(split_list);
+        List_Destroy(other_list);
+        List_Destroy(test_list);
+    }
+    //Test List init in buffer with improper args
+    TEST(ListInitInBufferTest, InvalidArgs) {
+        alignas(max_align_t) unsigned char buf[1024];
+        EXPECT_EQ(List_Buffer_Size(0), 0);
+        EXPECT_EQ(List_Buffer_Size(SIZE_MAX), 0);
+        EXPECT_EQ(List_Init_In_Buffer(NULL, sizeof(buf), 4, test_cmp_fnc, test_free_fnc), nullptr);
+        EXPECT_EQ(List_Init_In_Buffer(buf, sizeof(buf), 0, test_cmp_fnc, test_free_fnc), nullptr);
+        EXPECT_EQ(List_Init_In_Buffer(buf, sizeof(buf), 4, test_cmp_fnc, NULL), nullptr);
+        EXPECT_EQ(List_Init_In_Buffer(buf, List_Buffer_Size(4) - 1, 4, test_cmp_fnc, test_free_fnc), nullptr);
+        EXPECT_EQ(List_Init_In_Buffer(buf, sizeof(buf), 1000, test_cmp_fnc, test_free_fnc), nullptr);
+
+        List_t* test_list = List_Init_In_Buffer(buf, sizeof(buf), 2, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Insert(&test_val1, 1, test_list), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Length(test_list), 0);
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Create_Deque
+//{
+    //Test List create deque with valid args
+    TEST(ListCreateDequeTest, ValidArgs) {
+        List_t* test_list = List_Create_Deque(0, test_cmp_fnc, test_free_fnc);
+        ASSERT_NE(test_list, nullptr);
+        int vals[20];
+
+        //push at both ends so the ring wraps around as it grows
+        for (int i = 0; i < 10; i++)
+        {
+            vals[i] = i;
+            vals[19 - i] = 19 - i;
+            EXPECT_EQ(List_Push(&vals[19 - i], test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Unshift(&vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_Length(test_list), 20);
+        EXPECT_EQ(List_At(0, test_list), &vals[9]);
+        EXPECT_EQ(List_At(9, test_list), &vals[0]);
+        EXPECT_EQ(List_At(10, test_list), &vals[19]);
+        EXPECT_EQ(List_At(19, test_list), &vals[10]);
+
+        //middle inserts and removals move whichever side is shorter
+        EXPECT_EQ(List_Insert(&test_val1, 3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Insert(&test_val2, 18, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(3, test_list), &test_val1);
+        EXPECT_EQ(List_At(18, test_list), &test_val2);
+        EXPECT_EQ(List_At(19, test_list), &vals[12]);
+        EXPECT_EQ(List_Remove_At(3, test_list), &test_val1);
+        EXPECT_EQ(List_Remove_At(17, test_list), &test_val2);
+        EXPECT_EQ(List_At(3, test_list), &vals[6]);
+
+        EXPECT_EQ(List_Pop(test_list), &vals[10]);
+        EXPECT_EQ(List_Shift(test_list), &vals[9]);
+        EXPECT_EQ(List_Length(test_list), 18);
+
+        EXPECT_EQ(List_Reverse(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, test_list), &vals[11]);
+        EXPECT_EQ(List_At(17, test_list), &vals[8]);
+        EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+        for (int i = 0; i < 18; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, test_list), (i < 9) ? 19 - i : 17 - i);
+        }
+
+        List_Destroy(test_list);
+    }
+    //Test a deque holding its elements inline
+    TEST(ListCreateDequeTest, ValidSized) {
+        List_t* test_list = List_Create_Deque_Sized(sizeof(int), 4, test_cmp_fnc);
+        ASSERT_NE(test_list, nullptr);
+        int out = 0;
+
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Unshift(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Insert(&test_val3, 1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_NE(List_At(0, test_list), &test_val2);
+        EXPECT_EQ(*(int*)List_At(0, test_list), test_val2);
+
+        EXPECT_EQ(List_Sort(test_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Shift_Into(test_list, &out), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(out, test_val1);
+        EXPECT_EQ(List_Pop_Into(test_list, &out), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(out, test_val3);
+        EXPECT_EQ(List_Unshift(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Unshift(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Remove_At_Into(2, test_list, &out), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(out, test_val2);
+        EXPECT_EQ(List_Compact(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(test_list), 3);
+        EXPECT_EQ(*(int*)List_At(2, test_list), test_val3);
+
+        List_Destroy(test_list);
+    }
+    //Test moving elements in and out of a deque
+    TEST(ListCreateDequeTest, ValidMoves) {
+        List_t* deque_list = List_Create_Deque(0, test_cmp_fnc, free);
+        List_t* node_list = List_Create(0, test_cmp_fnc, free);
+
+        EXPECT_EQ(List_Push(double_int(&test_val1), node_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(double_int(&test_val2), node_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(double_int(&test_val3), deque_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Splice(deque_list, 0, node_list, 0, 2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(node_list), 0);
+        EXPECT_EQ(*(int*)List_At(1, deque_list), test_val2 * 2);
+
+        EXPECT_EQ(List_Transfer(deque_list, 0, deque_list, 2), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(2, deque_list), test_val1 * 2);
+        EXPECT_EQ(List_Transfer(deque_list, 2, deque_list, 0), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(0, deque_list), test_val1 * 2);
+        EXPECT_EQ(List_Transfer(deque_list, 1, node_list, 0), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(0, node_list), test_val2 * 2);
+
+        List_t* copy_list = List_Copy(deque_list, double_int);
+        ASSERT_NE(copy_list, nullptr);
+        EXPECT_EQ(*(int*)List_At(1, copy_list), test_val3 * 4);
+        List_t* split_list = List_Split(copy_list, 1);
+        ASSERT_NE(split_list, nullptr);
+        EXPECT_EQ(List_Concat(node_list, split_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(node_list), 2);
+        EXPECT_EQ(*(int*)List_At(1, node_list), test_val3 * 4);
+        EXPECT_EQ(List_Concat(deque_list, copy_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(deque_list), 3);
+
+        int* bad_val = (int*)malloc(sizeof(int));
+        *bad_val = 255;
+        EXPECT_EQ(List_Unshift(bad_val, deque_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Filter(deque_list, is_not_255), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(deque_list), 3);
+        EXPECT_EQ(*(int*)List_At(0, deque_list), test_val1 * 2);
+        EXPECT_EQ(*(int*)List_At(2, deque_list), test_val1 * 4);
+
+        List_Destroy(split_list);
+        List_Destroy(copy_list);
+        List_Destroy(node_list);
+        List_Destroy(deque_list);
+    }
+    //Test List create deque with improper args
+    TEST(ListCreateDequeTest, InvalidArgs) {
+        EXPECT_EQ(List_Create_Deque(10, test_cmp_fnc, NULL), nullptr);
+        EXPECT_EQ(List_Create_Deque_Sized(0, 10, test_cmp_fnc), nullptr);
+
+        List_t* test_list = List_Create_Deque(2, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Insert(&test_val1, 1, test_list), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_At(0, test_list), nullptr);
+        EXPECT_EQ(List_Pop(test_list), nullptr);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Unshift(&test_val3, test_list), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_At(2, test_list), nullptr);
+
+        List_t* sized_list = List_Create_Deque_Sized(sizeof(int), 10, test_cmp_fnc);
+        EXPECT_EQ(List_Concat(sized_list, test_list), LIST_ERROR_INVALID_PARAM);
+
+        List_Destroy(sized_list);
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Create_Heap
+//{
+    //Test List create heap with valid args
+    TEST(ListCreateHeapTest, ValidArgs) {
+        List_t* test_list = List_Create_Heap(0, test_cmp_fnc, test_free_fnc);
+        ASSERT_NE(test_list, nullptr);
+        int vals[20];
+        int max = 0;
+
+        for (int i = 0; i < 20; i++)
+        {
+            vals[i] = (i * 7) % 20;
+            max = (vals[i] > max) ? vals[i] : max;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(*(int*)List_Peek_Max(test_list), max);
+        }
+        //indices are checked but the heap picks the spot
+        EXPECT_EQ(List_Insert(&test_val1, 0, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Insert(&test_val1, 50, test_list), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Peek_Max(test_list), &test_val1);
+        EXPECT_EQ(List_Pop_Max(test_list), &test_val1);
+        EXPECT_EQ(List_Length(test_list), 20);
+
+        for (int i = 19; i >= 10; i--)
+        {
+            EXPECT_EQ(*(int*)List_Pop_Max(test_list), i);
+        }
+        //the first element is always the max, so shift takes it too
+        EXPECT_EQ(*(int*)List_Shift(test_list), 9);
+        EXPECT_EQ(*(int*)List_Peek_Max(test_list), 8);
+        EXPECT_EQ(List_Length(test_list), 9);
+
+        List_Destroy(test_list);
+    }
+    //Test a heap holding its elements inline, drained into a sorted list
+    TEST(ListCreateHeapTest, ValidSized) {
+        List_t* test_list = List_Create_Heap_Sized(sizeof(int), 10, test_cmp_fnc);
+        ASSERT_NE(test_list, nullptr);
+        int out = 0;
+
+        for (int i = 0; i < 10; i++)
+        {
+            int val = (i * 3) % 10;
+            EXPECT_EQ(List_Push(&val, test_list), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(List_Push(&out, test_list), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Pop_Max(test_list), nullptr);
+        EXPECT_EQ(List_Pop_Max_Into(test_list, &out), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(out, 9);
+
+        List_t* sorted_list = List_Heap_Drain(test_list);
+        ASSERT_NE(sorted_list, nullptr);
+        EXPECT_EQ(List_Length(test_list), 0);
+        EXPECT_EQ(List_Length(sorted_list), 9);
+        for (int i = 0; i < 9; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i, sorted_list), 8 - i);
+        }
+
+        //the emptied heap works as before
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_Peek_Max(test_list), test_val1);
+
+        List_Destroy(sorted_list);
+        List_Destroy(test_list);
+    }
+    //Test moving elements in and out of a heap
+    TEST(ListCreateHeapTest, ValidMoves) {
+        List_t* heap_list = List_Create_Heap(0, test_cmp_fnc, free);
+        List_t* node_list = List_Create(0, test_cmp_fnc, free);
+
+        EXPECT_EQ(List_Push(double_int(&test_val3), node_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(double_int(&test_val1), node_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(double_int(&test_val2), heap_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Concat(heap_list, node_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(heap_list), 3);
+        EXPECT_EQ(*(int*)List_Peek_Max(heap_list), test_val1 * 2);
+
+        //taking the max out leaves a heap behind
+        EXPECT_EQ(List_Transfer(heap_list, 0, node_list, 0), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_At(0, node_list), test_val1 * 2);
+        EXPECT_EQ(*(int*)List_Peek_Max(heap_list), test_val2 * 2);
+
+        List_t* copy_list = List_Copy(heap_list, double_int);
+        ASSERT_NE(copy_list, nullptr);
+        EXPECT_EQ(*(int*)List_Peek_Max(copy_list), test_val2 * 4);
+        EXPECT_EQ(List_Push(double_int(&test_val1), copy_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_Peek_Max(copy_list), test_val1 * 2);
+        EXPECT_EQ(List_Filter(copy_list, is_not_255), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*(int*)List_Peek_Max(copy_list), test_val1 * 2);
+        EXPECT_EQ(List_Sort(copy_list, NULL), LIST_ERROR_SUCCESS);
+        int* max_val = (int*)List_Pop_Max(copy_list);
+        ASSERT_NE(max_val, nullptr);
+        EXPECT_EQ(*max_val, test_val1 * 2);
+        EXPECT_EQ(*(int*)List_Peek_Max(copy_list), test_val2 * 4);
+        free(max_val);
+
+        List_Destroy(copy_list);
+        List_Destroy(node_list);
+        List_Destroy(heap_list);
+    }
+    //Test List create heap with improper args
+    TEST(ListCreateHeapTest, InvalidArgs) {
+        EXPECT_EQ(List_Create_Heap(10, NULL, test_free_fnc), nullptr);
+        EXPECT_EQ(List_Create_Heap(10, test_cmp_fnc, NULL), nullptr);
+        EXPECT_EQ(List_Create_Heap_Sized(0, 10, test_cmp_fnc), nullptr);
+        EXPECT_EQ(List_Create_Heap_Sized(sizeof(int), 10, NULL), nullptr);
+        EXPECT_EQ(List_Peek_Max(NULL), nullptr);
+        EXPECT_EQ(List_Pop_Max(NULL), nullptr);
+        EXPECT_EQ(List_Pop_Max_Into(NULL, NULL), LIST_ERROR_INVALID_PARAM);
+
+        List_t* test_list = List_Create_Heap(0, test_cmp_fnc, test_free_fnc);
+        int* out = NULL;
+        EXPECT_EQ(List_Peek_Max(test_list), nullptr);
+        EXPECT_EQ(List_Pop_Max_Into(test_list, &out), LIST_ERROR_INVALID_PARAM);
+
+        List_t* node_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Heap_Drain(node_list), nullptr);
+        EXPECT_EQ(List_Heap_Drain(NULL), nullptr);
+
+        List_Destroy(node_list);
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Pop_Max
+//{
+    //Test List pop max on lists that arent heaps
+    TEST(ListPopMaxTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Peek_Max(test_list), &test_val1);
+        EXPECT_EQ(List_Pop_Max(test_list), &test_val1);
+        EXPECT_EQ(List_Pop_Max(test_list), &test_val2);
+        EXPECT_EQ(List_Length(test_list), 1);
+        EXPECT_EQ(List_At(0, test_list), &test_val3);
+
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Top_K
+//{
+    //Test List top k against a full sort, ties included
+    TEST(ListTopKTest, ValidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        List_t* sized_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+        int vals[100];
+        for (int i = 0; i < 100; i++)
+        {
+            vals[i] = (i * 37) % 41;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Push(&vals[i], sized_list), LIST_ERROR_SUCCESS);
+        }
+        List_t* sorted_list = List_Copy(test_list, NULL);
+        EXPECT_EQ(List_Sort(sorted_list, NULL), LIST_ERROR_SUCCESS);
+
+        size_t ks[] = { 1, 5, 16, 17, 60, 100 };
+        for (size_t k : ks)
+        {
+            List_t* top_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+            EXPECT_EQ(List_Top_K(test_list, k, NULL, top_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(List_Length(top_list), k);
+            for (size_t i = 0; i < k; i++)
+            {
+                EXPECT_EQ(List_At(i, top_list), List_At(i, sorted_list));
+            }
+            List_Destroy(top_list);
+        }
+        //the list itself is untouched
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(List_At(i, test_list), &vals[i]);
+        }
+
+        //sized elements are copied, and come after anything already there
+        List_t* top_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+        int first = -1;
+        EXPECT_EQ(List_Push(&first, top_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Top_K(sized_list, 30, NULL, top_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(top_list), 31);
+        EXPECT_EQ(*(int*)List_At(0, top_list), -1);
+        for (size_t i = 0; i < 30; i++)
+        {
+            EXPECT_EQ(*(int*)List_At(i + 1, top_list), *(int*)List_At(i, sorted_list));
+        }
+        List_Destroy(top_list);
+
+        //asking for more than there is takes everything, and nothing is fine too
+        List_t* all_list = List_Create_Deque(0, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Top_K(test_list, 1000, NULL, all_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(all_list), 100);
+        EXPECT_EQ(List_At(99, all_list), List_At(99, sorted_list));
+        EXPECT_EQ(List_Top_K(test_list, 0, NULL, all_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Length(all_list), 100);
+        List_Destroy(all_list);
+
+        List_Destroy(sorted_list);
+        List_Destroy(sized_list);
+        List_Destroy(test_list);
+    }
+
+    //Test List top k with bad args
+    TEST(ListTopKTest, InvalidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        List_t* sized_list = List_Create_Sized(sizeof(int), 0, test_cmp_fnc);
+        List_t* small_list = List_Create(2, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val2, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val3, test_list), LIST_ERROR_SUCCESS);
+
+        EXPECT_EQ(List_Top_K(NULL, 1, NULL, test_list), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Top_K(test_list, 1, NULL, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Top_K(test_list, 1, NULL, test_list), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(List_Top_K(test_list, 1, NULL, sized_list), LIST_ERROR_INVALID_PARAM);
+        //nothing is added when it doesnt all fit
+        EXPECT_EQ(List_Top_K(test_list, 3, NULL, small_list), LIST_ERROR_EXCEED_LIMIT);
+        EXPECT_EQ(List_Length(small_list), 0);
+        EXPECT_EQ(List_Top_K(test_list, 2, NULL, small_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_At(0, small_list), &test_val1);
+        EXPECT_EQ(List_At(1, small_list), &test_val2);
+
+        List_Destroy(small_list);
+        List_Destroy(sized_list);
+        List_Destroy(test_list);
+    }
+//}
+
+//List_Nth_Element
+//{
+    //Test List nth element against a full sort, from both sides
+    TEST(ListNthElementTest, ValidArgs) {
+        List_t* test_list = List_Create_Compact(0, test_cmp_fnc, test_free_fnc);
+        int vals[75];
+        for (int i = 0; i < 75; i++)
+        {
+            vals[i] = (i * 13) % 29;
+            EXPECT_EQ(List_Push(&vals[i], test_list), LIST_ERROR_SUCCESS);
+        }
+        List_t* sorted_list = List_Copy(test_list, NULL);
+        EXPECT_EQ(List_Sort(sorted_list, NULL), LIST_ERROR_SUCCESS);
+
+        for (size_t n = 0; n < 75; n++)
+        {
+            EXPECT_EQ(List_Nth_Element(test_list, n, NULL), List_At(n, sorted_list));
+        }
+        for (int i = 0; i < 75; i++)
+        {
+            EXPECT_EQ(List_At(i, test_list), &vals[i]);
+        }
+
+        //without a cmp function everything is equal, so list order wins
+        List_t* plain_list = List_Create(0, NULL, test_free_fnc);
+        EXPECT_EQ(List_Push(&test_val3, plain_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Push(&test_val1, plain_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Nth_Element(plain_list, 0, NULL), &test_val3);
+        EXPECT_EQ(List_Nth_Element(plain_list, 1, NULL), &test_val1);
+        EXPECT_EQ(List_Nth_Element(plain_list, 0, test_cmp_fnc), &test_val1);
+
+        List_Destroy(plain_list);
+        List_Destroy(sorted_list);
+        List_Destroy(test_list);
+    }
+
+    //Test List nth element with bad args
+    TEST(ListNthElementTest, InvalidArgs) {
+        List_t* test_list = List_Create(0, test_cmp_fnc, test_free_fnc);
+        EXPECT_EQ(List_Nth_Element(NULL, 0, NULL), nullptr);
+        EXPECT_EQ(List_Nth_Element(test_list, 0, NULL), nullptr);
+        EXPECT_EQ(List_Push(&test_val1, test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(List_Nth_Element(test_list, 1, NULL), nullptr);
+        List_Destroy(test_list);
+    }
+//}
+
+//clist::list
+//{
+    //Test the C++ wrapper's basic operations and that it keeps the C library's order
+    TEST(ClistListTest, ValidArgs) {
+        clist::list<int> test_list;
+        EXPECT_TRUE(test_list.empty());
+        test_list.push_back(test_val3);
+        test_list.push_back(test_val1);
+        test_list.push_front(test_val2);
+        test_list.insert(1, 5);
+        EXPECT_EQ(test_list.size(), 4);
+        EXPECT_EQ(test_list.front(), test_val2);
+        EXPECT_EQ(test_list.back(), test_val1);
+        EXPECT_EQ(test_list[1], 5);
+        EXPECT_EQ(test_list.at(2), test_val3);
+        EXPECT_THROW(test_list.at(4), std::out_of_range);
+
+        //highest first by default, like List_Sort
+        test_list.sort();
+        std::vector<int> expected = { test_val1, test_val2, test_val3, 5 };
+        EXPECT_TRUE(std::equal(test_list.begin(), test_list.end(), expected.begin(), expected.end()));
+        EXPECT_EQ(*(int*)List_Peek_Max(test_list.get()), test_val1);
+
+        test_list.pop_front();
+        test_list.pop_back();
+        EXPECT_EQ(test_list.size(), 2);
+        test_list.clear();
+        test_list.pop_back();
+        EXPECT_TRUE(test_list.empty());
+    }
+
+    //Test the C++ wrapper's iterators with standard algorithms
+    TEST(ClistListTest, ValidIterators) {
+        clist::list<int, std::less<int>> test_list = { 9, 3, 7, 1, 3 };
+        EXPECT_EQ(std::accumulate(test_list.begin(), test_list.end(), 0), 23);
+        EXPECT_EQ(std::distance(test_list.begin(), test_list.end()), 5);
+        EXPECT_EQ(*std::prev(test_list.end()), 3);
+        EXPECT_EQ(*std::next(test_list.begin(), 2), 7);
+
+        std::vector<int> reversed(test_list.rbegin(), test_list.rend());
+        EXPECT_EQ(reversed, std::vector<int>({ 3, 1, 7, 3, 9 }));
+
+        //lowest first with std::less, and iterators can write
+        test_list.sort();
+        for (int& value : test_list)
+        {
+            value *= 2;
+        }
+        const clist::list<int, std::less<int>>& const_list = test_list;
+        std::vector<int> sorted(const_list.begin(), const_list.end());
+        EXPECT_EQ(sorted, std::vector<int>({ 2, 6, 6, 14, 18 }));
+
+        auto found = test_list.find(14);
+        EXPECT_NE(found, test_list.end());
+        EXPECT_EQ(*found, 14);
+        EXPECT_EQ(*--found, 6);
+        EXPECT_EQ(test_list.find(5), test_list.end());
+        clist::list<int, std::less<int>>::const_iterator const_found = test_list.find(2);
+        EXPECT_EQ(const_found, const_list.begin());
+
+        clist::list<int> empty_list;
+        EXPECT_EQ(empty_list.begin(), empty_list.end());
+        EXPECT_EQ(empty_list.find(1), empty_list.end());
+    }
+
+    //Test writes through the C++ wrapper never show up in a copy on write clone of its list
+    TEST(ClistListTest, ValidClones) {
+        clist::list<int> test_list = { 1, 2, 3, 4 };
+        List_t* clone_list = List_Clone_COW(test_list.get());
+        test_list[0] = 10;
+        test_list.at(1) = 20;
+        test_list.back() = 40;
+        EXPECT_EQ(*(int*)List_At(0, clone_list), 1);
+        EXPECT_EQ(*(int*)List_At(1, clone_list), 2);
+        EXPECT_EQ(*(int*)List_At(3, clone_list), 4);
+        List_Destroy(clone_list);
+
+        clone_list = List_Clone_COW(test_list.get());
+        for (int& value : test_list)
+        {
+            value = -value;
+        }
+        *test_list.rbegin() = 0;
+        EXPECT_EQ(*(int*)List_At(0, clone_list), 10);
+        EXPECT_EQ(*(int*)List_At(3, clone_list), 40);
+        EXPECT_EQ(test_list[0], -10);
+        EXPECT_EQ(test_list[3], 0);
+        List_Destroy(clone_list);
+
+        //reading through a const list leaves the storage shared
+        clone_list = List_Clone_COW(test_list.get());
+        const clist::list<int>& const_list = test_list;
+        EXPECT_EQ(const_list[1], -20);
+        EXPECT_EQ(*const_list.begin(), -10);
+        List_Destroy(clone_list);
+    }
+
+    //Test the C++ wrapper pops values that have no default constructor
+    TEST(ClistListTest, ValidNoDefault) {
+        struct Point
+        {
+            Point(int x, int y) : x(x), y(y) {}
+            int x;
+            int y;
+        };
+        struct Point_Greater
+        {
+            bool operator()(const Point& a, const Point& b) const { return a.x > b.x; }
+        };
+        clist::list<Point, Point_Greater> test_list;
+        test_list.push_back(Point(1, 2));
+        test_list.push_back(Point(3, 4));
+        test_list.push_back(Point(5, 6));
+        test_list.pop_back();
+        test_list.pop_front();
+        EXPECT_EQ(test_list.size(), 1);
+        EXPECT_EQ(test_list.front().x, 3);
+    }
+
+    //Test the C++ wrapper moves its list rather than copying it
+    TEST(ClistListTest, ValidMoves) {
+        clist::list<int> test_list = { 1, 2, 3 };
+        List_t* raw_list = test_list.get();
+        clist::list<int> moved_list(std::move(test_list));
+        EXPECT_EQ(moved_list.get(), raw_list);
+        EXPECT_EQ(test_list.get(), nullptr);
+        EXPECT_EQ(test_list.size(), 0);
+
+        clist::list<int> other_list = { 4 };
+        other_list = std::move(moved_list);
+        EXPECT_EQ(other_list.get(), raw_list);
+        EXPECT_EQ(other_list.size(), 3);
+        EXPECT_FALSE(std::is_copy_constructible<clist::list<int>>::value);
+    }
+
+    //Test the C++ wrapper reports errors as exceptions
+    TEST(ClistListTest, InvalidArgs) {
+        clist::list<int> test_list(2);
+        test_list.push_back(1);
+        test_list.push_back(2);
+        EXPECT_THROW(test_list.push_back(3), std::length_error);
+        EXPECT_EQ(test_list.size(), 2);
+    }
+//}
+
+//LIST_DEFINE
+//{
+    //Test a typed list through each of its operations
+    TEST(ListDefineTest, ValidArgs) {
+        Int_List* test_list = Int_List_Create(0);
+        ASSERT_NE(test_list, nullptr);
+        for (int i = 0; i < 100; i++)
+        {
+            EXPECT_EQ(Int_List_Push(test_list, (i * 37) % 101), LIST_ERROR_SUCCESS);
+        }
+        EXPECT_EQ(Int_List_Unshift(test_list, 500), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(Int_List_Length(test_list), 101);
+        EXPECT_EQ(*Int_List_At(test_list, 0), 500);
+        EXPECT_EQ(*Int_List_At(test_list, 2), 37);
+
+        size_t at = 0;
+        EXPECT_EQ(Int_List_Find(test_list, 74, &at), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(at, 3);
+        EXPECT_EQ(Int_List_Find(test_list, 101, &at), LIST_ERROR_EXCEED_LIMIT);
+
+        //the underlying list is still a list, sorting by the same precedence
+        List_t* copy_list = List_Copy(Int_List_List(test_list), NULL);
+        EXPECT_EQ(List_Sort(copy_list, NULL), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(Int_List_Sort(test_list), LIST_ERROR_SUCCESS);
+        for (size_t i = 0; i < 101; i++)
+        {
+            EXPECT_EQ(*Int_List_At(test_list, i), *(int*)List_At(i, copy_list));
+        }
+        List_Destroy(copy_list);
+
+        EXPECT_EQ(Int_List_Filter(test_list, int_is_odd), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(Int_List_Length(test_list), 50);
+        EXPECT_EQ(*Int_List_At(test_list, 0), 99);
+        EXPECT_EQ(*Int_List_At(test_list, 49), 1);
+        EXPECT_EQ(Int_List_For_Each(test_list, int_double), LIST_ERROR_SUCCESS);
+        int sum = 0;
+        EXPECT_EQ(Int_List_Reduce(test_list, int_sum, &sum), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(sum, 5000);
+
+        int out = 0;
+        EXPECT_EQ(Int_List_Pop(test_list, &out), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(out, 2);
+        EXPECT_EQ(Int_List_Shift(test_list, &out), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(out, 198);
+
+        Int_List_Destroy(test_list);
+    }
+
+    //Test typed operations on a list other threads write to, and on clones sharing its storage
+    TEST(ListDefineTest, ValidShared) {
+        Int_List* test_list = Int_List_Create(0);
+        for (int i = 0; i < 200; i++)
+        {
+            EXPECT_EQ(Int_List_Push(test_list, i), LIST_ERROR_SUCCESS);
+        }
+        std::atomic<bool> done(false);
+        std::thread writer([&]() {
+            int out = 0;
+            for (int i = 0; !done; i++)
+            {
+                Int_List_Push(test_list, i);
+                Int_List_Unshift(test_list, i);
+                Int_List_Shift(test_list, &out);
+                List_Compact(Int_List_List(test_list));
+            }
+        });
+        for (int round = 0; round < 200; round++)
+        {
+            size_t at = 0;
+            int sum = 0;
+            EXPECT_EQ(Int_List_Sort(test_list), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(Int_List_For_Each(test_list, int_double_yield), LIST_ERROR_SUCCESS);
+            EXPECT_EQ(Int_List_Reduce(test_list, int_sum, &sum), LIST_ERROR_SUCCESS);
+            Int_List_Find(test_list, 0, &at);
+            EXPECT_EQ(Int_List_Filter(test_list, int_is_odd_yield), LIST_ERROR_SUCCESS);
+        }
+        done = true;
+        writer.join();
+        Int_List_Destroy(test_list);
+
+        //writing to a clone leaves the list it shares storage with alone, even from a nested filter
+        test_list = Int_List_Create(0);
+        for (int i = 0; i < 10; i++)
+        {
+            EXPECT_EQ(Int_List_Push(test_list, i), LIST_ERROR_SUCCESS);
+        }
+        Int_List* clone_list = (Int_List*)List_Clone_COW(Int_List_List(test_list));
+        ASSERT_NE(clone_list, nullptr);
+        inner_list = clone_list;
+        EXPECT_EQ(Int_List_Sort(clone_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(Int_List_For_Each(clone_list, int_double), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(*Int_List_At(clone_list, 0), 18);
+        Int_List* other_list = (Int_List*)List_Clone_COW(Int_List_List(test_list));
+        inner_list = test_list;
+        EXPECT_EQ(Int_List_Filter(other_list, int_is_odd_filtering), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(Int_List_Length(other_list), 5);
+        EXPECT_EQ(Int_List_Length(test_list), 5);
+        EXPECT_EQ(*Int_List_At(other_list, 0), 1);
+        EXPECT_EQ(Int_List_Length(clone_list), 10);
+        EXPECT_EQ(*Int_List_At(clone_list, 9), 0);
+
+        Int_List_Destroy(other_list);
+        Int_List_Destroy(clone_list);
+        Int_List_Destroy(test_list);
+    }
+
+    //Test a typed list with bad args
+    TEST(ListDefineTest, InvalidArgs) {
+        Int_List* test_list = Int_List_Create(1);
+        size_t at = 0;
+        int out = 0;
+        EXPECT_EQ(Int_List_Find(NULL, 1, &at), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(Int_List_Find(test_list, 1, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(Int_List_Filter(test_list, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(Int_List_Sort(NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(Int_List_For_Each(test_list, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(Int_List_Reduce(test_list, int_sum, NULL), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(Int_List_Pop(test_list, &out), LIST_ERROR_INVALID_PARAM);
+        EXPECT_EQ(Int_List_Sort(test_list), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(Int_List_Push(test_list, 1), LIST_ERROR_SUCCESS);
+        EXPECT_EQ(Int_List_Push(test_list, 2), LIST_ERROR_EXCEED_LIMIT);
+        Int_List_Destroy(test_list);
+    }
+//}